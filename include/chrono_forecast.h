@@ -0,0 +1,159 @@
+#pragma once
+
+#include <vector>
+#include <quda_internal.h>
+#include <gram_cholesky.h>
+#include <color_spinor_field.h>
+#include <dirac_quda.h>
+
+namespace quda
+{
+
+  /**
+     @brief Compute the coefficients a of the chronological guess x =
+     sum_j a_j v_j from the projected system H a = phi.  Rather than
+     orthonormalizing the stored basis V, the basis metric G = V^dag V
+     = L L^dag orthonormalizes it implicitly, W = V L^{-dag}, so the
+     system solved is (L^{-1} H L^{-dag}) c = L^{-1} phi with a =
+     L^{-dag} c, and directions that are dependent in either the
+     metric or the projected operator get a zero coefficient.
+     @param[out] a The coefficients
+     @param[in] metric The factored basis metric
+     @param[in] H The projected operator, row major, Hermitian positive definite on the basis
+     @param[in] phi The projected source
+  */
+  inline void chronoProjection(Complex *a, const GramCholesky &metric, const Complex *H, const Complex *phi)
+  {
+    const int n = metric.size();
+    std::vector<Complex> y(n), c(n), Y(n * n), M(n * n);
+
+    // Y = L^{-1} H, one column at a time
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) c[i] = H[i * n + j];
+      metric.forwardSolve(y.data(), c.data());
+      for (int i = 0; i < n; i++) Y[i * n + j] = y[i];
+    }
+
+    // M = Y L^{-dag} = (L^{-1} Y^dag)^dag, one row of Y at a time
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) c[j] = std::conj(Y[i * n + j]);
+      metric.forwardSolve(y.data(), c.data());
+      for (int j = 0; j < n; j++) M[i * n + j] = std::conj(y[j]);
+    }
+
+    GramCholesky system(n);
+    system.assign(n, M.data());
+    metric.forwardSolve(y.data(), phi);
+    system.solve(c.data(), y.data());
+    metric.backwardSolve(a, c.data());
+  }
+
+  /**
+     @brief Store of previous solutions for chronological forecasting.
+     The basis is kept in the requested precision: at half or quarter
+     precision each site is stored as fixed point with its own scale,
+     so a long history can be kept at a fraction of the memory of the
+     solve precision.  Only the most recent max_device vectors are
+     kept in device memory, with older ones spilled to (pinned or
+     pageable) host memory and staged back when the forecast is
+     formed.  The stored vectors are never modified: the basis metric
+     is updated incrementally, at the cost of one row of inner
+     products for each new vector, and used to orthonormalize the
+     basis implicitly (see chronoProjection).  The forecast expands
+     each stored vector into the working precision once, so a spilled
+     vector is copied to the device once per forecast, and forms its
+     inner products as multi-reductions over the expanded basis.
+     Beyond the stored basis its peak footprint is therefore the
+     expanded vectors (none for device resident vectors already in the
+     working precision) and five working precision temporaries.  The
+     normal equations, used for non-Hermitian operators, also keep the
+     N vectors A v_j in the working precision.
+  */
+  class ChronoForecast
+  {
+    struct Vector {
+      ColorSpinorField *field = nullptr; // device copy, or nullptr if spilled
+      void *v = nullptr;                 // spilled field data
+      void *norm = nullptr;              // spilled site norms (fixed-point precisions only)
+    };
+
+    int max_dim;
+    const int max_device;
+    const bool pinned;
+    ColorSpinorParam param;
+
+    std::vector<Vector> basis; // storage slots
+    std::vector<int> age;      // slots ordered from newest to oldest
+    std::vector<bool> stale;   // whether a slot's row of the metric is out of date
+    GramCholesky metric;       // metric of the slots, G_ij = (v_i, v_j)
+
+    void *hostAlloc(size_t bytes);
+    void spill(Vector &vec);
+    void restore(Vector &vec, bool copy);
+
+    /**
+       @brief Expand the vector in a slot into the precision of
+       staging, or return it in place if it is device resident in
+       that precision
+       @param[in] slot The slot to load
+       @param[in] staging Field to expand the vector into
+       @param[in,out] spilled Storage precision field spilled vectors are restored through, created on first use
+       @return The vector
+    */
+    ColorSpinorField &load(int slot, ColorSpinorField &staging, ColorSpinorField *&spilled);
+
+  public:
+    /**
+       @param meta Field whose geometry the solutions share
+       @param max_dim Maximum number of stored solutions
+       @param precision Storage precision of the basis
+       @param max_device Number of most recent solutions kept in device memory (0 for all)
+       @param pinned Whether spilled solutions are kept in pinned host memory
+    */
+    ChronoForecast(const ColorSpinorField &meta, int max_dim, QudaPrecision precision, int max_device, bool pinned);
+
+    virtual ~ChronoForecast();
+
+    /** @return The number of stored solutions */
+    int size() const { return static_cast<int>(basis.size()); }
+
+    /** @return The maximum number of stored solutions */
+    int MaxDim() const { return max_dim; }
+
+    /**
+       @brief Change the maximum number of stored solutions, which may
+       not be smaller than the number presently stored
+    */
+    void MaxDim(int max_dim_)
+    {
+      if (max_dim_ < size()) errorQuda("Requested dimension %d is smaller than existing basis %d", max_dim_, size());
+      metric.reserve(max_dim_);
+      max_dim = max_dim_;
+    }
+
+    /** @return The storage precision of the basis */
+    QudaPrecision Precision() const { return param.Precision(); }
+
+    /**
+       @brief Add a solution to the basis, replacing the oldest once
+       the basis is full
+       @param x The solution
+       @param replace_last Whether to replace the most recent solution instead
+    */
+    void push(const ColorSpinorField &x, bool replace_last);
+
+    /**
+       @brief Form the minimum residual guess for A x = b in the space
+       of the stored solutions
+       @param[out] x The guess
+       @param[in] b The source, which is preserved
+       @param[in] mat The operator A
+       @param[in] precision The precision mat is applied in, to which the basis is expanded
+       @param[in] hermitian Whether A is Hermitian positive definite (else the normal equations are used)
+       @param[in] profile Profile to account the forecast to
+    */
+    void operator()(ColorSpinorField &x, const ColorSpinorField &b, const DiracMatrix &mat, QudaPrecision precision,
+                    bool hermitian, TimeProfile &profile);
+  };
+
+} // namespace quda
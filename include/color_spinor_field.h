@@ -968,6 +968,10 @@ namespace quda {
     bool init;
     bool reference; // whether the field is a reference or not
 
+    mutable MsgHandle *mh_ghost_send[2 * QUDA_MAX_DIM] = {}; // message handles for a split-phase ghost exchange
+    mutable MsgHandle *mh_ghost_recv[2 * QUDA_MAX_DIM] = {};
+    mutable bool ghost_exchange_active = false; // whether a split-phase ghost exchange is in flight
+
     void create(const QudaFieldCreate);
     void destroy();
 
@@ -1032,6 +1036,24 @@ namespace quda {
 		       const MemoryLocation *halo_location=nullptr, bool gdr_send=false, bool gdr_recv=false,
 		       QudaPrecision ghost_precision=QUDA_INVALID_PRECISION) const;
 
+    /**
+       @brief Start a split-phase ghost exchange: the faces are packed
+       (threaded over sites) and the receives and sends for all
+       partitioned dimensions are posted at once.  Host work that
+       does not depend on the halo may be done before the matching
+       call to exchangeGhostWait().
+       @param[in] parity Field parity
+       @param[in] nFace Depth of halo exchange
+       @param[in] dagger Is this for a dagger operator (only relevant for spin projected Wilson)
+     */
+    void exchangeGhostStart(QudaParity parity, int nFace, int dagger) const;
+
+    /**
+       @brief Complete a ghost exchange started with
+       exchangeGhostStart(), after which the ghost zone may be read.
+     */
+    void exchangeGhostWait() const;
+
     /**
        @brief Backs up the cpuColorSpinorField
     */
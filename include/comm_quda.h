@@ -294,6 +294,35 @@ extern "C" {
 						    size_t blksize, int nblocks, size_t stride);
 
   void comm_free(MsgHandle *&mh);
+
+  /**
+     @brief Register a memory region for persistent message handle
+     caching.  Message handles declared on buffers within a
+     registered region are not freed by comm_free, but are retained
+     (together with any committed datatypes) and returned by later
+     declarations with the same buffer, displacement, size and
+     stride, removing the per-exchange setup cost.  The region must
+     be invalidated with comm_handle_cache_invalidate before it is
+     freed or reallocated.
+     @param buffer Start of the memory region
+     @param nbytes Size of the memory region in bytes
+   */
+  void comm_handle_cache_register(void *buffer, size_t nbytes);
+
+  /**
+     @brief Invalidate a previously registered memory region: all
+     cached handles referencing the region are released (or detached
+     if presently in use, in which case they are released by the
+     subsequent comm_free).
+     @param buffer Start of the memory region passed to comm_handle_cache_register
+   */
+  void comm_handle_cache_invalidate(void *buffer);
+
+  /**
+     @brief Release all cached message handles and datatypes.
+   */
+  void comm_handle_cache_free();
+
   void comm_start(MsgHandle *mh);
   void comm_wait(MsgHandle *mh);
   int comm_query(MsgHandle *mh);
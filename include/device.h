@@ -1,6 +1,13 @@
+#pragma once
+
+#include <string>
+#include <enum_quda.h>
+
 namespace quda
 {
 
+  class Tunable;
+
   namespace device
   {
 
@@ -32,6 +39,67 @@ namespace quda
      */
     size_t max_dynamic_shared_memory();
 
+    /**
+       @brief Time the launches of a tunable at its current launch
+       parameters, after an untimed initial launch.  Called by
+       tuneLaunch for each candidate when autotuning.
+       @param[in] tunable The tunable being tuned
+       @param[out] time Time per launch in seconds
+       @param[out] error Description of the failure, if the launch failed
+       @return Whether the launch succeeded
+    */
+    bool time_launch(Tunable &tunable, float &time, std::string &error);
+
+    /**
+       The memory primitives below are what malloc.cpp builds its
+       tracked and checked allocators on.  The allocators return
+       nullptr and the others false on failure.
+    */
+
+    /**
+       @brief Allocate device memory
+     */
+    void *allocate(size_t size);
+
+    /**
+       @brief Allocate device memory that is guaranteed to be a unique
+       allocation, as required for peer-to-peer communication
+     */
+    void *allocate_peer(size_t size);
+
+    /**
+       @brief Allocate managed memory
+     */
+    void *allocate_managed(size_t size);
+
+    /**
+       @brief Free memory from allocate() or allocate_managed()
+     */
+    bool release(void *ptr);
+
+    /**
+       @brief Free memory from allocate_peer()
+     */
+    bool release_peer(void *ptr);
+
+    /**
+       @brief Page-lock host memory, optionally mapping it into the
+       device address space
+     */
+    bool register_host(void *ptr, size_t size, bool mapped);
+
+    /**
+       @brief Undo register_host()
+     */
+    bool unregister_host(void *ptr);
+
+    /**
+       @brief Query where memory resides
+       @return The location, or QUDA_INVALID_FIELD_LOCATION if the
+       target cannot tell, in which case the allocation is looked up
+     */
+    QudaFieldLocation pointer_location(const void *ptr);
+
     namespace profile
     {
 
@@ -45,6 +45,9 @@ namespace quda {
     cudaCloverField *clover;
     cudaGaugeField *xInvKD; // used for the Kahler-Dirac operator only
 
+    cpuGaugeField *gauge_h;   // host gauge field, used by Wilson-type operators applied to host fields
+    cpuCloverField *clover_h; // host clover field, used by clover operators applied to host fields
+
     double mu; // used by twisted mass only
     double mu_factor; // used by multigrid only
     double epsilon; //2nd tm parameter (used by twisted mass only)
@@ -66,17 +69,32 @@ namespace quda {
     DiracParam() :
       type(QUDA_INVALID_DIRAC),
       kappa(0.0),
+      mass(0.0),
       m5(0.0),
+      Ls(0),
+      eofa_shift(0.0),
+      eofa_pm(0),
+      mq1(0.0),
+      mq2(0.0),
+      mq3(0.0),
       matpcType(QUDA_MATPC_INVALID),
       dagger(QUDA_DAG_INVALID),
       gauge(0),
+      fatGauge(nullptr),
+      longGauge(nullptr),
+      laplace3D(0),
       clover(0),
+      xInvKD(nullptr),
+      gauge_h(nullptr),
+      clover_h(nullptr),
       mu(0.0),
       mu_factor(0.0),
       epsilon(0.0),
       tmp1(0),
       tmp2(0),
       halo_precision(QUDA_INVALID_PRECISION),
+      transfer(nullptr),
+      dirac(nullptr),
       need_bidirectional(false),
 #if (CUDA_VERSION >= 10010 && __COMPUTE_CAPABILITY__ >= 700)
       use_mma(true)
@@ -140,6 +158,7 @@ namespace quda {
 
   protected:
     cudaGaugeField *gauge;
+    cpuGaugeField *gauge_h; // host gauge field used when applying the operator to host fields
     double kappa;
     double mass;
     int laplace3D;
@@ -154,6 +173,14 @@ namespace quda {
     bool newTmp(ColorSpinorField **, const ColorSpinorField &) const;
     void deleteTmp(ColorSpinorField **, const bool &reset) const;
 
+    /**
+       @brief Return the gauge field resident in the same location as
+       the given field: the host gauge field for host fields, else the
+       device gauge field.
+       @param[in] a Field the operator is being applied to
+    */
+    const GaugeField &gaugeField(const ColorSpinorField &a) const;
+
     mutable int commDim[QUDA_MAX_DIM]; // whether do comms or not
 
     mutable TimeProfile profile;
@@ -444,9 +471,18 @@ namespace quda {
 
   protected:
     cudaCloverField *clover;
+    cpuCloverField *clover_h; // host clover field used when applying the operator to host fields
     void checkParitySpinor(const ColorSpinorField &, const ColorSpinorField &) const;
     void initConstants();
 
+    /**
+       @brief Return the clover field resident in the same location as
+       the given field: the host clover field for host fields, else the
+       device clover field.
+       @param[in] a Field the operator is being applied to
+    */
+    const CloverField &cloverField(const ColorSpinorField &a) const;
+
   public:
     DiracClover(const DiracParam &param);
     DiracClover(const DiracClover &dirac);
@@ -153,6 +153,38 @@ namespace quda {
       const CloverField &A, double kappa, const ColorSpinorField &x, int parity, bool dagger, const int *comm_override,
       TimeProfile &profile);
 
+  /**
+     @brief Host implementation of ApplyWilson, for space-spin-color
+     order spinors and QDP order gauge fields without reconstruction.
+     In partitioned dimensions the gauge field ghost must have been
+     exchanged by the caller; the spinor ghost is exchanged here.
+  */
+  void ApplyWilsonCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double kappa,
+                      const ColorSpinorField &x, int parity, bool dagger, const int *comm_override);
+
+  /**
+     @brief Host implementation of ApplyWilsonClover, with the clover
+     field in packed order.
+  */
+  void ApplyWilsonCloverCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U,
+                            const CloverField &A, double kappa, const ColorSpinorField &x, int parity, bool dagger,
+                            const int *comm_override);
+
+  /**
+     @brief Host implementation of ApplyWilsonCloverPreconditioned,
+     requires the host clover inverse to be allocated.
+  */
+  void ApplyWilsonCloverPreconditionedCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U,
+                                          const CloverField &A, double kappa, const ColorSpinorField &x, int parity,
+                                          bool dagger, const int *comm_override);
+
+  /**
+     @brief Host implementation of ApplyClover, supporting both the
+     direct and inverse application.
+  */
+  void ApplyCloverCPU(ColorSpinorField &out, const ColorSpinorField &in, const CloverField &clover, bool inverse,
+                      int parity);
+
   /**
      @brief Driver for applying the twisted-mass stencil
 
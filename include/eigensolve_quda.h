@@ -558,6 +558,11 @@ protected:
     Complex **Qmat;
     Complex **Rmat;
 
+    /** Number of shifts chased through the upper Hessenberg together */
+    static constexpr int qr_chain_shifts = 16;
+    /** Number of chase steps between applying the deferred rotations */
+    static constexpr int qr_chase_steps = 32;
+
     /**
        @brief Constructor for Thick Restarted Eigensolver class
        @param eig_param The eigensolver parameters
@@ -610,13 +615,6 @@ protected:
     */
     void qrShifts(const std::vector<Complex> evals, const int num_shifts);
 
-    /**
-       @brief Apply One step of the the QR algorithm
-       @param[in] Q The Q matrix
-       @param[in] R The R matrix
-    */
-    void qrIteration(Complex **Q, Complex **R);
-
     /**
        @brief Reorder the Krylov space and eigenvalues
        @param[in] kSpace The Krylov space
@@ -628,6 +626,40 @@ protected:
                  const QudaEigSpectrumType spec_type);
   };
 
+  /**
+     @brief Eigendecomposition of the symmetric arrow matrix of the
+     thick restarted Lanczos method, using divide and conquer on the
+     secular equation rather than a dense eigensolver.
+     @param[in] arrow_pos The row into which the arrow couples
+     @param[in] diag The diagonal of the matrix
+     @param[in] off The arrow elements (i < arrow_pos), then the
+     sub-diagonal (i >= arrow_pos)
+     @param[out] evals The eigenvalues in ascending order
+     @param[out] evecs The eigenvectors, with element j of vector i
+     stored at evecs[n * i + j]
+  */
+  void arrowEigensolve(int arrow_pos, const std::vector<double> &diag, const std::vector<double> &off,
+                       std::vector<double> &evals, std::vector<double> &evecs);
+
+  /**
+     @brief Apply a chain of implicitly shifted QR steps to an upper
+     Hessenberg matrix in place, chasing one bulge per shift, as used
+     by IRAM.  The rotations are applied to the diagonal region of H
+     as they are generated, and to the remainder of H and to Q in
+     blocks of chase_steps steps.  The result is that of applying the
+     shifted QR steps one after another: H <- G H G^dag and Q <- Q
+     G^dag for the accumulated rotation G.
+     @param[in,out] Q The accumulated unitary matrix
+     @param[in,out] H The n x n upper Hessenberg matrix
+     @param[in] n The dimension of H and Q
+     @param[in] shifts The shifts to apply
+     @param[in] num_shifts The number of shifts
+     @param[in] tol Sub-diagonal elements smaller than this are set to zero
+     @param[in] chase_steps Number of chase steps between applying the deferred rotations
+  */
+  void qrChase(Complex **Q, Complex **H, int n, const Complex *shifts, int num_shifts, double tol,
+               int chase_steps = IRAM::qr_chase_steps);
+
   /**
      arpack_solve()
 
@@ -130,6 +130,7 @@ typedef enum QudaInverterType_s {
   QUDA_CA_CGNE_INVERTER,
   QUDA_CA_CGNR_INVERTER,
   QUDA_CA_GCR_INVERTER,
+  QUDA_DIRECT_LU_INVERTER,
   QUDA_INVALID_INVERTER = QUDA_INVALID_ENUM
 } QudaInverterType;
 
@@ -383,6 +384,8 @@ typedef enum QudaSourceType_s {
 typedef enum QudaNoiseType_s {
   QUDA_NOISE_GAUSS,
   QUDA_NOISE_UNIFORM,
+  QUDA_NOISE_Z2,
+  QUDA_NOISE_Z4,
   QUDA_NOISE_INVALID = QUDA_INVALID_ENUM
 } QudaNoiseType;
 
@@ -130,6 +130,7 @@
 #define QUDA_CA_CGNE_INVERTER 23
 #define QUDA_CA_CGNR_INVERTER 24
 #define QUDA_CA_GCR_INVERTER 25
+#define QUDA_DIRECT_LU_INVERTER 26
 #define QUDA_INVALID_INVERTER QUDA_INVALID_ENUM
 
 #define QudaEigType integer(4)
@@ -360,6 +361,8 @@
 #define QudaNoiseType integer(4)
 #define QUDA_NOISE_GAUSS 0
 #define QUDA_NOISE_UNIFORM 1
+#define QUDA_NOISE_Z2 2
+#define QUDA_NOISE_Z4 3
 #define QUDA_NOISE_INVALID QUDA_INVALID_ENUM
 
 #define QudaProjectionType integer(4)
@@ -239,8 +239,11 @@ namespace quda {
          @param[out] recv Receive buffer
          @param[in] send Send buffer
          @param[in] dir Direction in which we are sending (forwards OR backwards only)
+         @param[in] n_set Number of sets of nDim buffers to exchange
+         (e.g., two for bi-directional links), all of which are
+         posted concurrently
       */
-      void exchange(void **recv, void **send, QudaDirection dir) const;
+      void exchange(void **recv, void **send, QudaDirection dir, int n_set = 1) const;
 
       /**
          Imaginary chemical potential
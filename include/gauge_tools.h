@@ -1,3 +1,4 @@
+#include <vector>
 #include <random_quda.h>
 
 namespace quda
@@ -168,4 +169,29 @@ namespace quda
   */
   void computeQChargeDensity(double energy[3], double &qcharge, void *qdensity, const GaugeField &Fmunu);
 
+  /**
+     @brief Observables computed by gaugeObservablesCPU.  Plaquettes
+     are site and plane averages normalized to the range [0,1], as for
+     plaquette().
+  */
+  struct GaugeObservablesCPU {
+    double plaquette[3]; /** total, spatial and temporal plaquette */
+    double energy[3];    /** total, spatial and temporal field energy */
+    double qcharge;      /** topological charge */
+  };
+
+  /**
+     @brief Compute gauge observables directly on a host gauge field
+     in a single threaded sweep over the lattice.  The field strength
+     is the clover-leaf definition used by computeFmunu, so energy and
+     charge agree with computeQCharge.  In partitioned dimensions u
+     must be an extended field with an exchanged halo of depth one.
+     @param[out] obs The computed observables
+     @param[in] u Host gauge field in QDP or MILC order
+     @param[in] fmunu Whether to compute the field energy and topological charge
+     @param[out] qcharge_density Optional host array, of the
+     precision of u, for the charge density at each lattice site
+  */
+  void gaugeObservablesCPU(GaugeObservablesCPU &obs, const GaugeField &u, bool fmunu, void *qcharge_density = nullptr);
+
 } // namespace quda
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <quda_internal.h>
+
+namespace quda
+{
+
+  /**
+     @brief A small Hermitian positive semi-definite matrix held
+     together with its Cholesky factor G = L L^dagger, for the dense
+     systems of the chronological forecast.  A row (and column) can be
+     replaced at a time, in which case only the trailing rows of the
+     factor are recomputed.  Directions whose pivot falls below
+     tol relative to their diagonal are linearly dependent on the
+     preceding ones: they are dropped from the factor (and the solves
+     give them a zero component) rather than failing it.
+  */
+  class GramCholesky
+  {
+    int n_max;
+    int n;
+    double tol;
+    std::vector<Complex> G; // the matrix, row major with leading dimension n_max
+    std::vector<Complex> L; // its lower triangular factor
+    std::vector<bool> active;
+
+    Complex &g(int i, int j) { return G[i * n_max + j]; }
+    Complex &l(int i, int j) { return L[i * n_max + j]; }
+    const Complex &l(int i, int j) const { return L[i * n_max + j]; }
+
+    void factor(int k0)
+    {
+      for (int k = k0; k < n; k++) {
+        for (int j = 0; j < k; j++) {
+          if (!active[j]) {
+            l(k, j) = 0.0;
+            continue;
+          }
+          Complex sum = g(k, j);
+          for (int m = 0; m < j; m++) sum -= l(k, m) * std::conj(l(j, m));
+          l(k, j) = sum / l(j, j).real();
+        }
+        double d = g(k, k).real();
+        for (int m = 0; m < k; m++) d -= std::norm(l(k, m));
+        active[k] = g(k, k).real() > 0.0 && d > tol * g(k, k).real();
+        l(k, k) = active[k] ? std::sqrt(d) : 0.0;
+        for (int j = k + 1; j < n_max; j++) l(k, j) = 0.0;
+      }
+    }
+
+  public:
+    /**
+       @param n_max Maximum dimension of the matrix
+       @param tol Relative pivot below which a direction is dropped
+    */
+    GramCholesky(int n_max = 0, double tol = 1e-12) :
+      n_max(n_max), n(0), tol(tol), G(n_max * n_max), L(n_max * n_max), active(n_max, false)
+    {
+    }
+
+    int size() const { return n; }
+
+    /**
+       @brief Raise the maximum dimension of the matrix, preserving its contents
+    */
+    void reserve(int n_max_)
+    {
+      if (n_max_ <= n_max) return;
+      std::vector<Complex> G_(n_max_ * n_max_), L_(n_max_ * n_max_);
+      for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+          G_[i * n_max_ + j] = G[i * n_max + j];
+          L_[i * n_max_ + j] = L[i * n_max + j];
+        }
+      G.swap(G_);
+      L.swap(L_);
+      active.resize(n_max_, false);
+      n_max = n_max_;
+    }
+
+    /**
+       @brief Grow or shrink the matrix to dimension n.  New rows are
+       zero until they are set with update.
+    */
+    void resize(int n_)
+    {
+      if (n_ > n_max) errorQuda("Requested dimension %d exceeds maximum %d", n_, n_max);
+      for (int i = n; i < n_; i++)
+        for (int j = 0; j < n_max; j++) G[i * n_max + j] = G[j * n_max + i] = 0.0;
+      int k0 = n < n_ ? n : n_;
+      n = n_;
+      factor(k0);
+    }
+
+    /**
+       @brief Replace row and column k of the matrix and update the
+       factor, which costs O((n-k) n^2) host flops
+       @param k Index of the row to replace
+       @param row The new row, row[j] = G(k,j) for j < size()
+    */
+    void update(int k, const Complex *row)
+    {
+      if (k < 0 || k >= n) errorQuda("Row %d out of range for dimension %d", k, n);
+      for (int j = 0; j < n; j++) {
+        g(k, j) = row[j];
+        g(j, k) = std::conj(row[j]);
+      }
+      g(k, k) = row[k].real();
+      factor(k);
+    }
+
+    /**
+       @brief Set the whole matrix and factor it
+       @param n_ The dimension
+       @param a The matrix, row major with leading dimension n_
+    */
+    void assign(int n_, const Complex *a)
+    {
+      if (n_ > n_max) errorQuda("Requested dimension %d exceeds maximum %d", n_, n_max);
+      n = n_;
+      for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) g(i, j) = a[i * n + j];
+      factor(0);
+    }
+
+    const Complex &operator()(int i, int j) const { return G[i * n_max + j]; }
+
+    /** @return Whether direction k is kept in the factor */
+    bool isActive(int k) const { return active[k]; }
+
+    /** @brief Solve L y = b, giving dropped directions y_k = 0 */
+    void forwardSolve(Complex *y, const Complex *b) const
+    {
+      for (int i = 0; i < n; i++) {
+        if (!active[i]) {
+          y[i] = 0.0;
+          continue;
+        }
+        Complex sum = b[i];
+        for (int j = 0; j < i; j++) sum -= l(i, j) * y[j];
+        y[i] = sum / l(i, i).real();
+      }
+    }
+
+    /** @brief Solve L^dagger x = y, giving dropped directions x_k = 0 */
+    void backwardSolve(Complex *x, const Complex *y) const
+    {
+      for (int i = n - 1; i >= 0; i--) {
+        if (!active[i]) {
+          x[i] = 0.0;
+          continue;
+        }
+        Complex sum = y[i];
+        for (int j = i + 1; j < n; j++) sum -= std::conj(l(j, i)) * x[j];
+        x[i] = sum / l(i, i).real();
+      }
+    }
+
+    /** @brief Solve G x = b in the space of the kept directions */
+    void solve(Complex *x, const Complex *b) const
+    {
+      std::vector<Complex> y(n);
+      forwardSolve(y.data(), b);
+      backwardSolve(x, y.data());
+    }
+  };
+
+} // namespace quda
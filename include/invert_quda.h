@@ -1172,6 +1172,47 @@ public:
       virtual bool hermitian() { return false; } /** CGNE is for any linear system */
   };
 
+  /**
+     @brief Direct solver for small systems, intended for the coarsest
+     grid of multigrid.  On the first solve the operator is assembled
+     into a dense matrix, by applying it to each unit vector, and LU
+     factorized on the host with partial pivoting and a threaded
+     trailing update.  Each rank assembles the rows of its own sites
+     and the factors are replicated over ranks, so every subsequent
+     solve is a forward and backward substitution after a single
+     reduction to gather the source.  The factors are kept for the
+     lifetime of the solver, so it must be recreated when the
+     operator changes: multigrid does so on setup and on a full
+     update, but a thin update (thin_update_only) leaves the coarse
+     operators, and so the factors, as they were.  The matrix costs
+     16 n^2 bytes per rank and O(n^3) work on every rank to factorize,
+     threaded only if built with QUDA_OPENMP, so this is only
+     sensible for coarsest grids of dimension a few thousand.
+  */
+  class DirectLU : public Solver
+  {
+  private:
+    std::vector<Complex> A; // LU factors of the operator, row major
+    std::vector<int> pivot; // row interchanges of the factorization
+    int n_local;            // degrees of freedom on this rank
+    int n;                  // total degrees of freedom
+    bool init;
+    ColorSpinorField *x_h; // host staging fields
+    ColorSpinorField *b_h;
+
+    void create(const ColorSpinorField &b);
+    void assemble(ColorSpinorField &x, ColorSpinorField &b);
+    void factorize();
+
+  public:
+    DirectLU(const DiracMatrix &mat, SolverParam &param, TimeProfile &profile);
+    virtual ~DirectLU();
+
+    void operator()(ColorSpinorField &out, ColorSpinorField &in);
+
+    virtual bool hermitian() { return false; } /** LU is for any linear system */
+  };
+
   class PreconditionedSolver : public Solver
   {
 private:
@@ -1286,6 +1327,11 @@ public:
      If Eigen support is enabled then Eigen's SVD algorithm is used
      for solving the linear system, else Gaussian elimination with
      partial pivots is used.
+
+     The projected system is rebuilt on every call.  Chronological
+     forecasting in invertQuda uses ChronoForecast instead, which
+     keeps the metric of its basis and its Cholesky factor across
+     solves and updates only the rows of replaced vectors.
   */
   class MinResExt {
 
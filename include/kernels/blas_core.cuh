@@ -71,6 +71,8 @@ namespace quda
 
     /**
        Generic blas kernel with four loads and up to four stores.
+       Sites are shared out between threads, each of which works on its
+       own copy of the functor.
     */
     template <typename real, int n, typename Arg> void blasCPU(Arg arg)
     {
@@ -79,21 +81,26 @@ namespace quda
 
       arg.f.init();
       for (int parity = 0; parity < arg.nParity; parity++) {
-        for (int i = 0; i < arg.length; i++) {
-          vec x, y, z, w, v;
-          if (arg.f.read.X) arg.X.load(x, i, parity);
-          if (arg.f.read.Y) arg.Y.load(y, i, parity);
-          if (arg.f.read.Z) arg.Z.load(z, i, parity);
-          if (arg.f.read.W) arg.W.load(w, i, parity);
-          if (arg.f.read.V) arg.V.load(v, i, parity);
-
-          arg.f(x, y, z, w, v);
-
-          if (arg.f.write.X) arg.X.save(x, i, parity);
-          if (arg.f.write.Y) arg.Y.save(y, i, parity);
-          if (arg.f.write.Z) arg.Z.save(z, i, parity);
-          if (arg.f.write.W) arg.W.save(w, i, parity);
-          if (arg.f.write.V) arg.V.save(v, i, parity);
+#pragma omp parallel
+        {
+          auto f = arg.f;
+#pragma omp for schedule(static)
+          for (int i = 0; i < arg.length; i++) {
+            vec x, y, z, w, v;
+            if (f.read.X) arg.X.load(x, i, parity);
+            if (f.read.Y) arg.Y.load(y, i, parity);
+            if (f.read.Z) arg.Z.load(z, i, parity);
+            if (f.read.W) arg.W.load(w, i, parity);
+            if (f.read.V) arg.V.load(v, i, parity);
+
+            f(x, y, z, w, v);
+
+            if (f.write.X) arg.X.save(x, i, parity);
+            if (f.write.Y) arg.Y.save(y, i, parity);
+            if (f.write.Z) arg.Z.save(z, i, parity);
+            if (f.write.W) arg.W.save(w, i, parity);
+            if (f.write.V) arg.V.save(v, i, parity);
+          }
         }
       }
     }
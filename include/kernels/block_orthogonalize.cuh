@@ -1,3 +1,4 @@
+#include <vector>
 #include <multigrid_helper.cuh>
 #include <fast_intdiv.h>
 
@@ -101,127 +102,125 @@ namespace quda {
   }
 
 #ifndef __CUDACC_RTC___
-  template <typename sumFloat, typename Float, int nSpin, int spinBlockSize, int nColor, int coarseSpin, int nVec, typename Arg>
-  void blockOrthoCPU(Arg &arg)
+  /**
+     @brief Copy an aggregate between the fine fields and a contiguous
+     local block.  Within the block, each chiral (coarse spin) block of
+     each vector is stored as a contiguous column of rows, with the
+     real and imaginary parts held in separate arrays so that the
+     column operations vectorize.
+     @param[in,out] re Real parts of the local block
+     @param[in,out] im Imaginary parts of the local block
+     @param[in] n_row Number of rows in each chiral block
+     @param[in] x_coarse The aggregate
+     @param[in] gather Whether to gather B into the block (else scatter the block into V)
+  */
+  template <typename Float, int nSpin, int nColor, int coarseSpin, int nVec, typename Arg>
+  inline void blockOrthoCopy(Float *re, Float *im, int n_row, Arg &arg, int x_coarse, bool gather)
   {
-    // loop over geometric blocks
-#pragma omp parallel for
-    for (int x_coarse=0; x_coarse<arg.coarseVolume; x_coarse++) {
-
-      // first copy over raw components into the container
-      for (int j = 0; j < nVec; j++) {
-        for (int parity = 0; parity < arg.nParity; parity++) {
-          parity = (arg.nParity == 2) ? parity : arg.parity;
-          for (int b = 0; b < arg.geoBlockSizeCB; b++) {
-            int x = arg.coarse_to_fine[(x_coarse * 2 + parity) * arg.geoBlockSizeCB + b];
-            int x_cb = x - parity * arg.fineVolumeCB;
-            for (int s = 0; s < nSpin; s++) {
-              for (int c = 0; c < nColor; c++) {
-                arg.V(parity, x_cb, s, c, j) = arg.B[j](parity, x_cb, s, c);
+    int row[coarseSpin] = {};
+    for (int parity = 0; parity < arg.nParity; parity++) {
+      parity = (arg.nParity == 2) ? parity : arg.parity;
+      for (int b = 0; b < arg.geoBlockSizeCB; b++) {
+        int x = arg.coarse_to_fine[(x_coarse * 2 + parity) * arg.geoBlockSizeCB + b];
+        int x_cb = x - parity * arg.fineVolumeCB;
+        for (int s = 0; s < nSpin; s++) {
+          const int cs = arg.spin_map(s, parity);
+          for (int c = 0; c < nColor; c++) {
+            const int r = row[cs]++;
+            for (int j = 0; j < nVec; j++) {
+              const int k = (cs * nVec + j) * n_row + r;
+              if (gather) {
+                complex<Float> v = arg.B[j](parity, x_cb, s, c);
+                re[k] = v.real();
+                im[k] = v.imag();
+              } else {
+                arg.V(parity, x_cb, s, c, j) = complex<Float>(re[k], im[k]);
               }
             }
           }
         }
       }
+    }
+  }
 
-      // loop over number of block orthos
-      for (int n = 0; n < arg.nBlockOrtho; n++) {
-        for (int j = 0; j < nVec; j++) {
-
-          for (int i = 0; i < j; i++) {
-
-            // compute (j,i) block inner products
-
-            complex<sumFloat> dot[coarseSpin];
-            for (int s = 0; s < coarseSpin; s++) dot[s] = 0.0;
-            for (int parity = 0; parity < arg.nParity; parity++) {
-              parity = (arg.nParity == 2) ? parity : arg.parity;
-
-              for (int b = 0; b < arg.geoBlockSizeCB; b++) {
-
-                int x = arg.coarse_to_fine[(x_coarse * 2 + parity) * arg.geoBlockSizeCB + b];
-                int x_cb = x - parity * arg.fineVolumeCB;
-
-                complex<Float> v[nSpin][nColor];
-                for (int s = 0; s < nSpin; s++)
-                  for (int c = 0; c < nColor; c++) v[s][c] = arg.V(parity, x_cb, s, c, j);
+  /**
+     @brief CPU block orthogonalization.  Each aggregate is copied into
+     a contiguous thread-local block, and each of its chiral blocks is
+     orthonormalized with classical Gram-Schmidt with one full
+     reorthogonalization (CGS2), so that the projections against all
+     previous vectors are long unit-stride dot products and updates.
+     CGS2 gives orthogonality to working precision, as the modified
+     Gram-Schmidt used on the GPU does.  The block is then copied into V.
+  */
+  template <typename sumFloat, typename Float, int nSpin, int spinBlockSize, int nColor, int coarseSpin, int nVec, typename Arg>
+  void blockOrthoCPU(Arg &arg)
+  {
+    const int n_row = arg.nParity * arg.geoBlockSizeCB * nSpin * nColor / coarseSpin;
 
-                for (int s = 0; s < nSpin; s++) {
-                  complex<Float> vis[nColor];
-                  for (int c = 0; c < nColor; c++) vis[c] = arg.V(parity, x_cb, s, c, i);
-                  colorInnerProduct<nColor>(dot[arg.spin_map(s, parity)], i, v[s], vis);
+#pragma omp parallel
+    {
+      std::vector<Float> re(coarseSpin * nVec * n_row);
+      std::vector<Float> im(coarseSpin * nVec * n_row);
+      std::vector<sumFloat> dot_re(nVec), dot_im(nVec);
+
+      // loop over geometric blocks
+#pragma omp for schedule(static)
+      for (int x_coarse = 0; x_coarse < arg.coarseVolume; x_coarse++) {
+
+        blockOrthoCopy<Float, nSpin, nColor, coarseSpin, nVec>(re.data(), im.data(), n_row, arg, x_coarse, true);
+
+        for (int cs = 0; cs < coarseSpin; cs++) {
+          // loop over number of block orthos
+          for (int n = 0; n < arg.nBlockOrtho; n++) {
+            for (int j = 0; j < nVec; j++) {
+              Float *vr = re.data() + (cs * nVec + j) * n_row;
+              Float *vi = im.data() + (cs * nVec + j) * n_row;
+
+              for (int pass = 0; pass < (j > 0 ? 2 : 0); pass++) {
+                // compute the inner products with all previous vectors
+                for (int i = 0; i < j; i++) {
+                  const Float *wr = re.data() + (cs * nVec + i) * n_row;
+                  const Float *wi = im.data() + (cs * nVec + i) * n_row;
+                  sumFloat dr = 0.0, di = 0.0;
+#pragma omp simd reduction(+ : dr, di)
+                  for (int r = 0; r < n_row; r++) {
+                    dr += wr[r] * vr[r] + wi[r] * vi[r];
+                    di += wr[r] * vi[r] - wi[r] * vr[r];
+                  }
+                  dot_re[i] = dr;
+                  dot_im[i] = di;
                 }
-              }
-            }
-
-            // subtract the i blocks to orthogonalise
-            for (int parity = 0; parity < arg.nParity; parity++) {
-              parity = (arg.nParity == 2) ? parity : arg.parity;
 
-              for (int b = 0; b < arg.geoBlockSizeCB; b++) {
-
-                int x = arg.coarse_to_fine[(x_coarse * 2 + parity) * arg.geoBlockSizeCB + b];
-                int x_cb = x - parity * arg.fineVolumeCB;
-
-                complex<Float> v[nSpin][nColor];
-                for (int s = 0; s < nSpin; s++)
-                  for (int c = 0; c < nColor; c++) v[s][c] = arg.V(parity, x_cb, s, c, j);
-
-                for (int s = 0; s < nSpin; s++) {
-                  complex<Float> vis[nColor];
-                  for (int c = 0; c < nColor; c++) vis[c] = arg.V(parity, x_cb, s, c, i);
-                  colorScaleSubtract<Float, nColor>(v[s], static_cast<complex<Float>>(dot[arg.spin_map(s, parity)]), vis);
+                // subtract the projections to orthogonalise
+                for (int i = 0; i < j; i++) {
+                  const Float *wr = re.data() + (cs * nVec + i) * n_row;
+                  const Float *wi = im.data() + (cs * nVec + i) * n_row;
+                  const Float ar = dot_re[i], ai = dot_im[i];
+#pragma omp simd
+                  for (int r = 0; r < n_row; r++) {
+                    vr[r] -= ar * wr[r] - ai * wi[r];
+                    vi[r] -= ar * wi[r] + ai * wr[r];
+                  }
                 }
-
-                for (int s = 0; s < nSpin; s++)
-                  for (int c = 0; c < nColor; c++) arg.V(parity, x_cb, s, c, j) = v[s][c];
               }
-            }
-
-          } // i
-
-          sumFloat nrm[coarseSpin] = {};
-          for (int parity = 0; parity < arg.nParity; parity++) {
-            parity = (arg.nParity == 2) ? parity : arg.parity;
-
-            for (int b = 0; b < arg.geoBlockSizeCB; b++) {
-
-              int x = arg.coarse_to_fine[(x_coarse * 2 + parity) * arg.geoBlockSizeCB + b];
-              int x_cb = x - parity * arg.fineVolumeCB;
-
-              complex<Float> v[nSpin][nColor];
-              for (int s = 0; s < nSpin; s++)
-                for (int c = 0; c < nColor; c++) v[s][c] = arg.V(parity, x_cb, s, c, j);
-              for (int s = 0; s < nSpin; s++) { colorNorm<nColor>(nrm[arg.spin_map(s, parity)], v[s]); }
-            }
-          }
 
-          for (int s = 0; s < coarseSpin; s++) nrm[s] = nrm[s] > 0.0 ? rsqrt(nrm[s]) : 0.0;
-
-          for (int parity = 0; parity < arg.nParity; parity++) {
-            parity = (arg.nParity == 2) ? parity : arg.parity;
-
-            for (int b = 0; b < arg.geoBlockSizeCB; b++) {
-
-              int x = arg.coarse_to_fine[(x_coarse * 2 + parity) * arg.geoBlockSizeCB + b];
-              int x_cb = x - parity * arg.fineVolumeCB;
-
-              complex<Float> v[nSpin][nColor];
-              for (int s = 0; s < nSpin; s++)
-                for (int c = 0; c < nColor; c++) v[s][c] = arg.V(parity, x_cb, s, c, j);
-
-              for (int s = 0; s < nSpin; s++) { colorScale<Float, nColor>(v[s], nrm[arg.spin_map(s, parity)]); }
-
-              for (int s = 0; s < nSpin; s++)
-                for (int c = 0; c < nColor; c++) arg.V(parity, x_cb, s, c, j) = v[s][c];
-            }
-          }
-
-        } // j
+              sumFloat nrm = 0.0;
+#pragma omp simd reduction(+ : nrm)
+              for (int r = 0; r < n_row; r++) nrm += vr[r] * vr[r] + vi[r] * vi[r];
+              const Float scale = nrm > 0.0 ? rsqrt(nrm) : 0.0;
+#pragma omp simd
+              for (int r = 0; r < n_row; r++) {
+                vr[r] *= scale;
+                vi[r] *= scale;
+              }
+            } // j
+          }   // n
+        }     // cs
 
-      } // n
+        blockOrthoCopy<Float, nSpin, nColor, coarseSpin, nVec>(re.data(), im.data(), n_row, arg, x_coarse, false);
 
-    } // x_coarse
+      } // x_coarse
+    }
   }
 #endif
 
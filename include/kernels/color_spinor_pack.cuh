@@ -131,14 +131,21 @@ namespace quda {
     }
   }
 
+  /**
+     CPU halo packer.  Each site writes to distinct ghost-zone
+     locations for every face, so we thread over sites and have each
+     thread pack all faces of its sites in a single pass.
+   */
   template <typename Float, bool block_float, int Ns, int Ms, int Nc, int Mc, int nDim, typename Arg>
   void GenericPackGhost(Arg &arg) {
-    for (int parity=0; parity<arg.nParity; parity++) {
-      parity = (arg.nParity == 2) ? parity : arg.parity;
+    for (int parity_=0; parity_<arg.nParity; parity_++) {
+      const int parity = (arg.nParity == 2) ? parity_ : arg.parity;
       const int spinor_parity = (arg.nParity == 2) ? parity : 0;
-      for (int dim=0; dim<4; dim++)
-	for (int dir=0; dir<2; dir++)
-	  for (int x_cb=0; x_cb<arg.volumeCB; x_cb++)
+#pragma omp parallel for
+      for (int x_cb=0; x_cb<arg.volumeCB; x_cb++)
+        for (int dim=0; dim<4; dim++) {
+          if (!arg.commDim[dim]) continue;
+	  for (int dir=0; dir<2; dir++)
 	    for (int spin_block=0; spin_block<Ns; spin_block+=Ms)
 	      for (int color_block=0; color_block<Nc; color_block+=Mc)
 		switch(dir) {
@@ -158,6 +165,7 @@ namespace quda {
 		  case 3: packGhost<Float,block_float,Ns,Ms,Nc,Mc,nDim,3,1>(arg, x_cb, parity, spinor_parity, spin_block, color_block); break;
 		  }
 		}
+        }
     }
   }
 
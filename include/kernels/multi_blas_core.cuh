@@ -141,6 +141,53 @@ namespace quda
       }
     }
 
+    /**
+       @brief Host variant of the generic multi-blas kernel.  Each
+       thread owns a range of sites, and for each site the NXZ x/z
+       vectors are loaded once and reused across the whole NXZ x NYW
+       tile, rather than being reloaded for each y/w vector as is done
+       on the device.  The order of functor application for each
+       (k, l) pair is the same as multiBlasKernel.
+       @param[in,out] arg Argument struct with required meta data
+       (input/output fields, functor, etc.)
+       @param[in] nParity Number of parities in the fields
+    */
+    template <typename real, int n, int NXZ, typename Arg> void multiBlasCPU(Arg &arg, int nParity)
+    {
+      // n is real numbers per thread
+      using vec = vector_type<complex<real>, n/2>;
+
+      for (int parity = 0; parity < nParity; parity++) {
+#pragma omp parallel
+        {
+          auto f = arg.f;
+#pragma omp for schedule(static)
+          for (int idx = 0; idx < arg.length; idx++) {
+            vec x[NXZ], z[NXZ];
+            for (int l = 0; l < NXZ; l++) {
+              if (f.read.X) arg.X[l].load(x[l], idx, parity);
+              if (f.read.Z) arg.Z[l].load(z[l], idx, parity);
+            }
+
+            for (int k = 0; k < arg.NYW; k++) {
+              vec y, w;
+              if (f.read.Y) arg.Y[k].load(y, idx, parity);
+              if (f.read.W) arg.W[k].load(w, idx, parity);
+
+              for (int l = 0; l < NXZ; l++) {
+                // functors take x and z by reference, so pass copies to keep the tile loads pristine
+                vec x_ = x[l], z_ = z[l];
+                f(x_, y, z_, w, k, l);
+              }
+
+              if (f.write.Y) arg.Y[k].save(y, idx, parity);
+              if (f.write.W) arg.W[k].save(w, idx, parity);
+            }
+          }
+        }
+      }
+    }
+
     template <typename coeff_t_, bool multi_1d_ = false>
     struct MultiBlasFunctor {
       using coeff_t = coeff_t_;
@@ -5,6 +5,7 @@
 #include <blas_helper.cuh>
 #include <multi_blas_helper.cuh>
 #include <fast_intdiv.h>
+#include <vector>
 
 namespace quda
 {
@@ -108,6 +109,79 @@ namespace quda
       arg.template reduce<block_size>(sum, k);
     } // multiReduceKernel
 
+    /**
+       Number of sites in each partial sum of the CPU multi-reduction.
+       This is independent of the number of threads, so the result is
+       reproducible regardless of the thread count.
+    */
+    constexpr int multi_reduce_cpu_chunk = 1024;
+
+    /**
+       @brief Host variant of the generic multi-reduce kernel.  For
+       each site the NXZ x/z vectors are loaded once and reused across
+       the whole NXZ x NYW tile.  Each (parity, chunk) pair
+       accumulates its own NXZ x NYW block of partial sums, and these
+       are combined in chunk order so the result is deterministic.
+       @param[in,out] arg Argument struct with required meta data
+       (input/output fields, functor, etc.)
+       @param[in] nParity Number of parities in the fields
+       @return Reductions in the same order as the device kernel,
+       e.g., result[k * NXZ + l] for y vector k and x vector l
+    */
+    template <typename real, int n, int NXZ, typename Arg>
+    std::vector<typename Arg::Reducer::reduce_t> multiReduceCPU(Arg &arg, int nParity)
+    {
+      // n is real numbers per thread
+      using vec = vector_type<complex<real>, n/2>;
+
+      using reduce_t = typename Arg::Reducer::reduce_t;
+      const int tile = arg.NYW * NXZ;
+      const int n_chunk = (arg.length + multi_reduce_cpu_chunk - 1) / multi_reduce_cpu_chunk;
+      std::vector<reduce_t> partial(nParity * n_chunk * tile);
+
+#pragma omp parallel
+      {
+        auto r = arg.r;
+#pragma omp for collapse(2) schedule(static)
+        for (int parity = 0; parity < nParity; parity++) {
+          for (int c = 0; c < n_chunk; c++) {
+            reduce_t *sum = &partial[(parity * n_chunk + c) * tile];
+            for (int t = 0; t < tile; t++) ::quda::zero(sum[t]);
+
+            const int end = std::min((c + 1) * multi_reduce_cpu_chunk, arg.length);
+            for (int idx = c * multi_reduce_cpu_chunk; idx < end; idx++) {
+              vec x[NXZ], z[NXZ];
+              for (int l = 0; l < NXZ; l++) {
+                if (r.read.X) arg.X[l].load(x[l], idx, parity);
+                if (r.read.Z) arg.Z[l].load(z[l], idx, parity);
+              }
+
+              for (int k = 0; k < arg.NYW; k++) {
+                vec y, w;
+                if (r.read.Y) arg.Y[k].load(y, idx, parity);
+                if (r.read.W) arg.W[k].load(w, idx, parity);
+
+                for (int l = 0; l < NXZ; l++) {
+                  vec x_ = x[l], z_ = z[l];
+                  r(sum[k * NXZ + l], x_, y, z_, w, k, l);
+                }
+
+                if (r.write.Y) arg.Y[k].save(y, idx, parity);
+                if (r.write.W) arg.W[k].save(w, idx, parity);
+              }
+            }
+          }
+        }
+      }
+
+      std::vector<reduce_t> result(tile);
+      for (auto &s : result) ::quda::zero(s);
+      for (int p = 0; p < nParity * n_chunk; p++)
+        for (int t = 0; t < tile; t++) result[t] += partial[p * tile + t];
+
+      return result;
+    }
+
     /**
        Base class from which all reduction functors should derive.
 
@@ -4,6 +4,7 @@
 #include <blas_helper.cuh>
 #include <reduce_helper.h>
 #include <fast_intdiv.h>
+#include <vector>
 
 namespace quda
 {
@@ -80,8 +81,18 @@ namespace quda
       arg.template reduce<block_size>(sum);
     }
 
+    /**
+       Number of sites in each partial sum of the CPU reduction.  This
+       is independent of the number of threads, so the result of the
+       reduction is reproducible regardless of the thread count.
+    */
+    constexpr int reduce_cpu_chunk = 1024;
+
     /**
        Generic reduction kernel with up to four loads and three saves.
+       The sites are partitioned into fixed-size chunks that are
+       reduced in parallel, and the partial sums are then combined in
+       chunk order, so the result is deterministic.
     */
     template <typename real, int n, typename Arg> auto reduceCPU(Arg &arg)
     {
@@ -89,30 +100,47 @@ namespace quda
       using vec = vector_type<complex<real>, n/2>;
 
       using reduce_t = typename Arg::Reducer::reduce_t;
-      reduce_t sum;
-      ::quda::zero(sum);
+      const int n_chunk = (arg.length + reduce_cpu_chunk - 1) / reduce_cpu_chunk;
+      std::vector<reduce_t> partial(arg.nParity * n_chunk);
 
-      for (int parity = 0; parity < arg.nParity; parity++) {
-        for (int i = 0; i < arg.length; i++) {
-          vec x, y, z, w, v;
-          if (arg.r.read.X) arg.X.load(x, i, parity);
-          if (arg.r.read.Y) arg.Y.load(y, i, parity);
-          if (arg.r.read.Z) arg.Z.load(z, i, parity);
-          if (arg.r.read.W) arg.W.load(w, i, parity);
-          if (arg.r.read.V) arg.V.load(v, i, parity);
-
-          arg.r.pre();
-          arg.r(sum, x, y, z, w, v);
-          arg.r.post(sum);
-
-          if (arg.r.write.X) arg.X.save(x, i, parity);
-          if (arg.r.write.Y) arg.Y.save(y, i, parity);
-          if (arg.r.write.Z) arg.Z.save(z, i, parity);
-          if (arg.r.write.W) arg.W.save(w, i, parity);
-          if (arg.r.write.V) arg.V.save(v, i, parity);
+#pragma omp parallel
+      {
+        auto r = arg.r;
+#pragma omp for collapse(2) schedule(static)
+        for (int parity = 0; parity < arg.nParity; parity++) {
+          for (int c = 0; c < n_chunk; c++) {
+            reduce_t sum;
+            ::quda::zero(sum);
+
+            const int end = std::min((c + 1) * reduce_cpu_chunk, arg.length);
+            for (int i = c * reduce_cpu_chunk; i < end; i++) {
+              vec x, y, z, w, v;
+              if (r.read.X) arg.X.load(x, i, parity);
+              if (r.read.Y) arg.Y.load(y, i, parity);
+              if (r.read.Z) arg.Z.load(z, i, parity);
+              if (r.read.W) arg.W.load(w, i, parity);
+              if (r.read.V) arg.V.load(v, i, parity);
+
+              r.pre();
+              r(sum, x, y, z, w, v);
+              r.post(sum);
+
+              if (r.write.X) arg.X.save(x, i, parity);
+              if (r.write.Y) arg.Y.save(y, i, parity);
+              if (r.write.Z) arg.Z.save(z, i, parity);
+              if (r.write.W) arg.W.save(w, i, parity);
+              if (r.write.V) arg.V.save(v, i, parity);
+            }
+
+            partial[parity * n_chunk + c] = sum;
+          }
         }
       }
 
+      reduce_t sum;
+      ::quda::zero(sum);
+      for (auto &p : partial) sum += p;
+
       return sum;
     }
 
@@ -1,3 +1,4 @@
+#include <vector>
 #include <color_spinor_field_order.h>
 #include <gauge_field_order.h>
 #include <multigrid_helper.cuh>
@@ -55,6 +56,108 @@ namespace quda {
 
   };
 
+  template <typename Float_, int coarseDof_, int fineColor_, bool dagger_, typename fineColorSpinor, typename xInvGauge>
+  struct ApplyStaggeredKDBlockCPUArg {
+
+    using Float = Float_;
+
+    static constexpr int fineColor = fineColor_;
+    static constexpr int coarseColor = 8 * fineColor;
+    static constexpr int coarseDof = coarseDof_;
+    static constexpr bool dagger = dagger_;
+
+    fineColorSpinor out;      /** Output staggered spinor field */
+    const fineColorSpinor in; /** Input staggered spinor field */
+    const xInvGauge xInv;     /** Kahler-Dirac inverse field */
+
+    int x_size[QUDA_MAX_DIM];   /** Dimensions of fine grid */
+    int xc_size[QUDA_MAX_DIM];  /** Dimensions of coarse grid */
+
+    const int coarseVolumeCB;   /** Coarse grid volume */
+
+    ApplyStaggeredKDBlockCPUArg(fineColorSpinor &out, const fineColorSpinor &in, const xInvGauge &xInv,
+                                const int *x_size_, const int *xc_size_) :
+      out(out),
+      in(in),
+      xInv(xInv),
+      coarseVolumeCB(xInv.VolumeCB())
+    {
+      for (int i=0; i<QUDA_MAX_DIM; i++) {
+        x_size[i] = x_size_[i];
+        xc_size[i] = xc_size_[i];
+      }
+    }
+
+  };
+
+  /**
+     @brief Apply the KD block inverse on the host, one hypercube at a
+     time.  The 16 fine sites of a hypercube are gathered into a
+     48-component vector, indexed as in the KD block build, the block
+     of Xinv (conjugate transposed for dagger) is loaded into a private
+     tile with split real and imaginary parts, and the mat-vec is then
+     a sequence of unit-stride dot products.
+  */
+  template <typename Arg> void ApplyStaggeredKDBlockCPU(Arg &arg)
+  {
+    using real = typename Arg::Float;
+    constexpr int n = Arg::coarseDof;
+
+#pragma omp parallel
+    {
+      std::vector<real> x_re(n * n), x_im(n * n);
+      real in_re[n], in_im[n];
+      int fine_cb[16], fine_parity[16], fine_dof[16];
+
+#pragma omp for collapse(2) schedule(static)
+      for (int parity_c = 0; parity_c < 2; parity_c++) {
+        for (int x_cb_c = 0; x_cb_c < arg.coarseVolumeCB; x_cb_c++) {
+          int coord_coarse[4];
+          getCoords(coord_coarse, x_cb_c, arg.xc_size, parity_c);
+
+          // gather the hypercube
+          for (int corner = 0; corner < 16; corner++) {
+            int coord[4];
+            for (int d = 0; d < 4; d++) coord[d] = 2 * coord_coarse[d] + ((corner >> d) & 1);
+            fine_parity[corner] = (coord[0] + coord[1] + coord[2] + coord[3]) & 1;
+            fine_cb[corner] = (((coord[3] * arg.x_size[2] + coord[2]) * arg.x_size[1] + coord[1]) * arg.x_size[0] + coord[0]) >> 1;
+            fine_dof[corner] = fine_parity[corner] * Arg::coarseColor + 4 * (coord[3] % 2) + 2 * (coord[2] % 2) + (coord[1] % 2);
+            for (int c = 0; c < Arg::fineColor; c++) {
+              const complex<real> v = arg.in(fine_parity[corner], fine_cb[corner], 0, c);
+              in_re[fine_dof[corner] + 8 * c] = v.real();
+              in_im[fine_dof[corner] + 8 * c] = v.imag();
+            }
+          }
+
+          // load the block into the tile
+          for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+              const auto x = Arg::dagger ? arg.xInv(0, parity_c, x_cb_c, 0, 0, j, i) : arg.xInv(0, parity_c, x_cb_c, 0, 0, i, j);
+              x_re[i * n + j] = x.real();
+              x_im[i * n + j] = Arg::dagger ? -x.imag() : x.imag();
+            }
+          }
+
+          // multiply and scatter back to the hypercube
+          for (int corner = 0; corner < 16; corner++) {
+            for (int c = 0; c < Arg::fineColor; c++) {
+              const int i = fine_dof[corner] + 8 * c;
+              const real *xr = x_re.data() + i * n;
+              const real *xi = x_im.data() + i * n;
+              real sum_re = 0.0, sum_im = 0.0;
+#pragma omp simd reduction(+ : sum_re, sum_im)
+              for (int j = 0; j < n; j++) {
+                sum_re += xr[j] * in_re[j] - xi[j] * in_im[j];
+                sum_im += xr[j] * in_im[j] + xi[j] * in_re[j];
+              }
+              arg.out(fine_parity[corner], fine_cb[corner], 0, c) = complex<real>(sum_re, sum_im);
+            }
+          }
+        }
+      }
+    }
+  }
+
   template<typename Arg>
   __global__ void ApplyStaggeredKDBlockGPU(Arg arg)
   {
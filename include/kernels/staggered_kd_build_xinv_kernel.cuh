@@ -1,3 +1,4 @@
+#include <vector>
 #include <color_spinor_field_order.h>
 #include <gauge_field_order.h>
 #include <multigrid_helper.cuh>
@@ -117,8 +118,9 @@ namespace quda {
   template<typename Arg>
   void ComputeStaggeredKDBlockCPU(Arg arg)
   {
+    // every fine site writes distinct elements of X, so both parities can be threaded together
+#pragma omp parallel for collapse(2) schedule(static)
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) { // Loop over fine volume
         for (int ic_f=0; ic_f<Arg::fineColor; ic_f++) {
           for (int jc_f=0; jc_f<Arg::fineColor; jc_f++) {
@@ -129,6 +131,192 @@ namespace quda {
     } // parity
   }
 
+  template <typename Float_, int fineColor_, typename fineGauge, typename xInvGauge>
+  struct CalculateStaggeredKDBlockInverseCPUArg {
+
+    using Float = Float_;
+    static constexpr int fineColor = fineColor_;
+    static constexpr int coarseColor = 8 * fineColor;
+    static constexpr int coarseDof = 2 * coarseColor; /** Degrees of freedom in a KD block */
+
+    xInvGauge xInv;     /** Kahler-Dirac inverse field */
+    const fineGauge U;  /** Fine grid (fat-)link field */
+
+    int x_size[QUDA_MAX_DIM];   /** Dimensions of fine grid */
+    int xc_size[QUDA_MAX_DIM];  /** Dimensions of coarse grid */
+
+    const double mass;          /** staggered mass value */
+    const int fineVolumeCB;     /** Fine grid volume */
+    const int coarseVolumeCB;   /** Coarse grid volume */
+
+    CalculateStaggeredKDBlockInverseCPUArg(xInvGauge &xInv, const fineGauge &U, const double mass,
+                                           const int *x_size_, const int *xc_size_) :
+      xInv(xInv),
+      U(U),
+      mass(mass),
+      fineVolumeCB(U.VolumeCB()),
+      coarseVolumeCB(xInv.VolumeCB())
+    {
+      for (int i=0; i<QUDA_MAX_DIM; i++) {
+        x_size[i] = x_size_[i];
+        xc_size[i] = xc_size_[i];
+      }
+    }
+
+  };
+
+  /**
+     @brief Assemble the KD block of one hypercube into a row-major
+     tile, split into real and imaginary parts.  The row and column
+     indices are those of ComputeStaggeredKDBlock: (fine parity) * 24 +
+     8 * (fine color) + (hypercube corner).
+     @param[out] re Real part of the block
+     @param[out] im Imaginary part of the block
+     @param[in] arg Kernel argument
+     @param[in] parity_c Parity of the coarse site
+     @param[in] x_cb_c Checkerboard index of the coarse site
+  */
+  template <typename Arg, typename real>
+  inline void assembleStaggeredKDBlockCPU(real *re, real *im, const Arg &arg, int parity_c, int x_cb_c)
+  {
+    constexpr int n = Arg::coarseDof;
+    constexpr int nDim = 4;
+    for (int i = 0; i < n * n; i++) re[i] = im[i] = 0.0;
+    // staggered mass term on the diagonal
+    for (int i = 0; i < n; i++) re[i * n + i] = 2.0 * arg.mass;
+
+    int coord_coarse[nDim];
+    getCoords(coord_coarse, x_cb_c, arg.xc_size, parity_c);
+
+    for (int corner = 0; corner < 16; corner++) {
+      int coord[nDim];
+      for (int d = 0; d < nDim; d++) coord[d] = 2 * coord_coarse[d] + ((corner >> d) & 1);
+      const int parity = (coord[0] + coord[1] + coord[2] + coord[3]) & 1;
+      const int x_cb = (((coord[3] * arg.x_size[2] + coord[2]) * arg.x_size[1] + coord[1]) * arg.x_size[0] + coord[0]) >> 1;
+      const int hyperCorner = 4 * (coord[3] % 2) + 2 * (coord[2] % 2) + (coord[1] % 2);
+
+      for (int mu = 0; mu < nDim; mu++) {
+        // only links that stay within the hypercube contribute
+        if (coord[mu] % 2) continue;
+        coord[mu]++;
+        const int hyperCorner_mu = 4 * (coord[3] % 2) + 2 * (coord[2] % 2) + (coord[1] % 2);
+        coord[mu]--;
+
+        for (int ic_f = 0; ic_f < Arg::fineColor; ic_f++) {
+          for (int jc_f = 0; jc_f < Arg::fineColor; jc_f++) {
+            const complex<typename Arg::Float> vuv = arg.U(mu, parity, x_cb, ic_f, jc_f);
+            const int row = parity * Arg::coarseColor + 8 * ic_f + hyperCorner;
+            const int col = (1 - parity) * Arg::coarseColor + 8 * jc_f + hyperCorner_mu;
+            // backwards
+            re[col * n + row] = vuv.real();
+            im[col * n + row] = -vuv.imag();
+            // forwards
+            re[row * n + col] = -vuv.real();
+            im[row * n + col] = -vuv.imag();
+          }
+        }
+      }
+    }
+  }
+
+  /**
+     @brief In-place Gauss-Jordan inversion with partial pivoting of
+     an n x n row-major complex matrix stored as split real and
+     imaginary parts.  Each elimination is a unit-stride row update.
+     @param[in,out] re Real part of the matrix, replaced by its inverse
+     @param[in,out] im Imaginary part of the matrix, replaced by its inverse
+     @param[out] pivot Workspace of length n for the row interchanges
+  */
+  template <int n, typename real> inline void invertStaggeredKDBlockCPU(real *re, real *im, int *pivot)
+  {
+    for (int k = 0; k < n; k++) {
+      int p = k;
+      real max = re[k * n + k] * re[k * n + k] + im[k * n + k] * im[k * n + k];
+      for (int i = k + 1; i < n; i++) {
+        const real a = re[i * n + k] * re[i * n + k] + im[i * n + k] * im[i * n + k];
+        if (a > max) {
+          max = a;
+          p = i;
+        }
+      }
+      if (max == 0.0) errorQuda("Singular KD block");
+      pivot[k] = p;
+      if (p != k) {
+#pragma omp simd
+        for (int j = 0; j < n; j++) {
+          const real r = re[k * n + j], m = im[k * n + j];
+          re[k * n + j] = re[p * n + j];
+          im[k * n + j] = im[p * n + j];
+          re[p * n + j] = r;
+          im[p * n + j] = m;
+        }
+      }
+
+      // scale the pivot row, leaving the inverse column in place of column k
+      const real ir = re[k * n + k] / max, ii = -im[k * n + k] / max;
+      re[k * n + k] = 1.0;
+      im[k * n + k] = 0.0;
+#pragma omp simd
+      for (int j = 0; j < n; j++) {
+        const real r = re[k * n + j], m = im[k * n + j];
+        re[k * n + j] = ir * r - ii * m;
+        im[k * n + j] = ir * m + ii * r;
+      }
+
+      // eliminate column k from all other rows
+      for (int i = 0; i < n; i++) {
+        if (i == k) continue;
+        const real fr = re[i * n + k], fi = im[i * n + k];
+        re[i * n + k] = 0.0;
+        im[i * n + k] = 0.0;
+#pragma omp simd
+        for (int j = 0; j < n; j++) {
+          re[i * n + j] -= fr * re[k * n + j] - fi * im[k * n + j];
+          im[i * n + j] -= fr * im[k * n + j] + fi * re[k * n + j];
+        }
+      }
+    }
+
+    // undo the row interchanges by swapping columns in reverse order
+    for (int k = n - 1; k >= 0; k--) {
+      if (pivot[k] == k) continue;
+      for (int i = 0; i < n; i++) {
+        const real r = re[i * n + k], m = im[i * n + k];
+        re[i * n + k] = re[i * n + pivot[k]];
+        im[i * n + k] = im[i * n + pivot[k]];
+        re[i * n + pivot[k]] = r;
+        im[i * n + pivot[k]] = m;
+      }
+    }
+  }
+
+  /**
+     @brief Build, invert and store the KD block inverse one hypercube
+     at a time.  Each thread assembles and inverts its block in a
+     private double precision tile that stays in cache, so neither X
+     nor any other full-volume temporary is needed.
+  */
+  template <typename Arg> void ComputeStaggeredKDBlockInverseCPU(Arg &arg)
+  {
+    constexpr int n = Arg::coarseDof;
+#pragma omp parallel
+    {
+      std::vector<double> re(n * n), im(n * n);
+      std::vector<int> pivot(n);
+
+#pragma omp for collapse(2) schedule(static)
+      for (int parity_c = 0; parity_c < 2; parity_c++) {
+        for (int x_cb_c = 0; x_cb_c < arg.coarseVolumeCB; x_cb_c++) {
+          assembleStaggeredKDBlockCPU(re.data(), im.data(), arg, parity_c, x_cb_c);
+          invertStaggeredKDBlockCPU<n>(re.data(), im.data(), pivot.data());
+          for (int i = 0; i < n; i++)
+            for (int j = 0; j < n; j++)
+              arg.xInv(0, parity_c, x_cb_c, 0, 0, i, j) = complex<typename Arg::Float>(re[i * n + j], im[i * n + j]);
+        }
+      }
+    }
+  }
+
   template<typename Arg>
   __global__ void ComputeStaggeredKDBlockGPU(Arg arg)
   {
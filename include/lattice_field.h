@@ -608,13 +608,20 @@ namespace quda {
     void checkField(const LatticeField &a) const;
 
     /**
-       Read in the field specified by filenemae
+       Read in the field specified by filename.  The file must have
+       been written by LatticeField::write from a field with the same
+       precision, order, local volume and process grid.  Each rank
+       reads its own data in parallel, and the per-rank checksum is
+       verified.
        @param filename The name of the file to read
     */
     virtual void read(char *filename);
 
     /**
-       Write the field in the file specified by filename
+       Write the field in the file specified by filename using the
+       native binary format: a self-describing header, a table of
+       per-rank checksums, and then the raw local field data of each
+       rank at fixed offsets, written in parallel with pwrite.
        @param filename The name of the file to write
     */
     virtual void write(char *filename);
@@ -8,6 +8,21 @@ void read_spinor_field(const char *filename, void *V[], QudaPrecision precision,
                        QudaParity parity, int nColor, int nSpin, int Nvec, int argc, char *argv[]);
 void write_spinor_field(const char *filename, void *V[], QudaPrecision precision, const int *X, QudaSiteSubset subset,
                         QudaParity parity, int nColor, int nSpin, int Nvec, int argc, char *argv[]);
+
+/*
+  Streaming interface: the file is held open between calls so that a
+  set of vectors can be read or written one record at a time, with
+  each record holding count fields.  The returned handles are opaque.
+*/
+void *open_spinor_field_read(const char *filename, const int *X, QudaSiteSubset subset);
+int read_spinor_record_count(void *handle);
+void read_spinor_record(void *handle, void *V[], QudaPrecision precision, QudaSiteSubset subset, QudaParity parity,
+                        int nColor, int nSpin, int count);
+void close_spinor_field_read(void *handle);
+void *open_spinor_field_write(const char *filename, const int *X, QudaSiteSubset subset);
+void write_spinor_record(void *handle, void *V[], QudaPrecision precision, QudaSiteSubset subset, QudaParity parity,
+                         int nColor, int nSpin, int count);
+void close_spinor_field_write(void *handle);
 #else
 inline void read_gauge_field(const char *filename, void *gauge[], QudaPrecision prec, const int *X, int argc,
                              char *argv[])
@@ -35,5 +50,42 @@ inline void write_spinor_field(const char *filename, void *V[], QudaPrecision pr
   printf("QIO support has not been enabled\n");
   exit(-1);
 }
+inline void *open_spinor_field_read(const char *filename, const int *X, QudaSiteSubset subset)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline int read_spinor_record_count(void *handle)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void read_spinor_record(void *handle, void *V[], QudaPrecision precision, QudaSiteSubset subset,
+                               QudaParity parity, int nColor, int nSpin, int count)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void close_spinor_field_read(void *handle)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void *open_spinor_field_write(const char *filename, const int *X, QudaSiteSubset subset)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void write_spinor_record(void *handle, void *V[], QudaPrecision precision, QudaSiteSubset subset,
+                                QudaParity parity, int nColor, int nSpin, int count)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void close_spinor_field_write(void *handle)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
 
 #endif
@@ -385,6 +385,14 @@ extern "C" {
     /** Precision to store the chronological basis in */
     QudaPrecision chrono_precision;
 
+    /** Number of most recent chronological vectors kept in device
+        memory, with older ones spilled to host memory (0 keeps all on
+        the device) */
+    int chrono_max_device_dim;
+
+    /** Whether spilled chronological vectors are kept in pinned host memory */
+    QudaBoolean chrono_spill_pinned;
+
     /** Which external library to use in the linear solvers (MAGMA or Eigen) */
     QudaExtLibType extlib_type;
 
@@ -441,6 +449,9 @@ extern "C" {
     /** Use Eigen routines to eigensolve the upper Hessenberg via QR **/
     QudaBoolean use_eigen_qr;
 
+    /** Use Eigen routines to eigensolve the TRLM arrow matrix, else use the arrowhead divide and conquer solver **/
+    QudaBoolean use_eigen_arrow;
+
     /** Performs an MdagM solve, then constructs the left and right SVD. **/
     QudaBoolean compute_svd;
 
@@ -517,6 +528,11 @@ extern "C" {
         MILC I/O) */
     QudaBoolean io_parity_inflate;
 
+    /** Number of vectors staged at a time when saving or loading.
+        If zero, all vectors are staged at once and saved as a single
+        record, which is the format older versions of QUDA read */
+    int io_chunk_size;
+
     /** The Gflops rate of the eigensolver setup */
     double gflops;
 
@@ -592,7 +608,12 @@ extern "C" {
     /** Post orthonormalize vectors in the setup phase */
     QudaBoolean post_orthonormalize;
 
-    /** The solver that wraps around the coarse grid correction and smoother */
+    /** The solver that wraps around the coarse grid correction and
+        smoother.  On the coarsest level this may be
+        QUDA_DIRECT_LU_INVERTER, which solves the coarsest grid exactly
+        with a dense LU factorization on the host.  The factorization
+        is redone on setup and on a full update but not on a thin
+        update (thin_update_only) */
     QudaInverterType coarse_solver[QUDA_MAX_MG_LEVEL];
 
     /** Tolerance for the solver that wraps around the coarse grid correction and smoother */
@@ -691,6 +712,10 @@ extern "C" {
     /** Filename prefix for where to save the null-space vectors */
     char vec_outfile[QUDA_MAX_MG_LEVEL][256];
 
+    /** Number of null-space vectors staged at a time when saving or
+        loading (see QudaEigParam::io_chunk_size) */
+    int vec_io_chunk_size;
+
     /** Whether to use and initial guess during coarse grid deflation */
     QudaBoolean coarse_guess;
 
@@ -5,6 +5,7 @@
 #ifdef __CUDACC_RTC__
 #define RNG int
 #else
+#include <cstdint>
 #include <curand_kernel.h>
 
 namespace quda {
@@ -18,48 +19,119 @@ typedef struct curandStateMRG32k3a cuRNGState;
 #endif
 
 /**
-   @brief Class declaration to initialize and hold CURAND RNG states
+   @brief One Philox4x32-10 block (Salmon et al, SC11): ten rounds of
+   the Philox bijection applied to a 128-bit counter under a 64-bit key.
+   @param[in,out] ctr Counter on input, random output on return
+   @param[in] key Key
+*/
+__host__ __device__ inline void philox4x32_10(uint32_t ctr[4], const uint32_t key_[2])
+{
+  constexpr uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+  constexpr uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+  uint32_t key[2] = {key_[0], key_[1]};
+
+  for (int r = 0; r < 10; r++) {
+    const uint64_t p0 = static_cast<uint64_t>(M0) * ctr[0];
+    const uint64_t p1 = static_cast<uint64_t>(M1) * ctr[2];
+    const uint32_t c0 = static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0];
+    const uint32_t c2 = static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1];
+    ctr[0] = c0;
+    ctr[1] = static_cast<uint32_t>(p1);
+    ctr[2] = c2;
+    ctr[3] = static_cast<uint32_t>(p0);
+    key[0] += W0;
+    key[1] += W1;
+  }
+}
+
+/**
+   @brief Host RNG state: a counter-based Philox4x32-10 stream per
+   site.  The n-th block drawn at the site with global lexicographic
+   index g (the same index used to select the curand subsequence on
+   the device) is the Philox4x32-10 block of the counter (n_lo, n_hi,
+   g_lo, g_hi) under the key (seed_lo, seed_hi).  Each block yields
+   two uniform numbers in (0,1], taken from the top 53 bits of its
+   low and high 64-bit halves respectively.  The stream at each site
+   thus depends only on the seed, the global site and the number of
+   blocks previously drawn there, and not on how the sites are
+   distributed among threads or processes.
+*/
+struct HostRNGState {
+  uint32_t key[2];  /*! key derived from the seed */
+  uint64_t site;    /*! global lexicographic site index */
+  uint64_t counter; /*! number of blocks drawn so far */
+};
+
+/**
+   @brief Draw the next block from a host RNG state
+   @param[in,out] state Host RNG state
+   @param[out] u0 First uniform random number in (0,1]
+   @param[out] u1 Second uniform random number in (0,1]
+*/
+inline void Random(HostRNGState &state, double &u0, double &u1)
+{
+  uint32_t ctr[4] = {static_cast<uint32_t>(state.counter), static_cast<uint32_t>(state.counter >> 32),
+                     static_cast<uint32_t>(state.site), static_cast<uint32_t>(state.site >> 32)};
+  philox4x32_10(ctr, state.key);
+  state.counter++;
+  u0 = (((static_cast<uint64_t>(ctr[0]) << 32 | ctr[1]) >> 11) + 1) * 0x1.0p-53;
+  u1 = (((static_cast<uint64_t>(ctr[2]) << 32 | ctr[3]) >> 11) + 1) * 0x1.0p-53;
+}
+
+/**
+   @brief Class declaration to initialize and hold RNG states: these
+   are curand states for device RNGs, or counter-based HostRNGState
+   streams for host RNGs.
 */
 class RNG {
 
   private:
   cuRNGState *state;        /*! array with current curand rng state */
   cuRNGState *backup_state; /*! array for backup of current curand rng state */
+  HostRNGState *host_state;        /*! array with current host rng state */
+  HostRNGState *host_backup_state; /*! array for backup of current host rng state */
+  QudaFieldLocation location;      /*! @brief whether this is a device (curand) or host (Philox) RNG */
   unsigned long long seed;  /*! initial rng seed */
   int size;                 /*! @brief number of curand states */
   int size_cb;        /*! @brief number of curand states checkerboarded (equal to size if we have a single parity) */
   int X[4];           /*! @brief local lattice dimensions */
-  void AllocateRNG(); /*! @brief allocate curand rng states array in device memory */
+  void AllocateRNG(); /*! @brief allocate rng states array in device or host memory */
 
   public:
   /**
      @brief Constructor that takes its metadata from a field
      @param[in] meta The field whose data we use
      @param[in] seed Seed to initialize the RNG
+     @param[in] location Whether to create a device or host RNG
   */
-  RNG(const LatticeField &meta, unsigned long long seedin);
+  RNG(const LatticeField &meta, unsigned long long seedin, QudaFieldLocation location = QUDA_CUDA_FIELD_LOCATION);
 
   /**
      @brief Constructor that takes its metadata from a param
      @param[in] param The param whose data we use
      @param[in] seed Seed to initialize the RNG
+     @param[in] location Whether to create a device or host RNG
    */
-  RNG(const LatticeFieldParam &param, unsigned long long seedin);
+  RNG(const LatticeFieldParam &param, unsigned long long seedin, QudaFieldLocation location = QUDA_CUDA_FIELD_LOCATION);
 
   /*! free array */
   void Release();
 
-  /*! initialize curand rng states with seed */
+  /*! initialize rng states with seed */
   void Init();
 
   unsigned long long Seed() { return seed; };
 
+  QudaFieldLocation Location() const { return location; }
+
   __host__ __device__ __inline__ cuRNGState *State() { return state; };
 
-  /*! @brief Restore CURAND array states initialization */
+  HostRNGState *HostState() { return host_state; };
+
+  /*! @brief Restore RNG array states initialization */
   void restore();
 
-  /*! @brief Backup CURAND array states initialization */
+  /*! @brief Backup RNG array states initialization */
   void backup();
 };
 
@@ -7,13 +7,17 @@ namespace quda
 
   /**
      @brief VectorIO is a simple wrapper class for loading and saving
-     sets of vector fields using QIO.
+     sets of vector fields using QIO.  Vectors may be streamed
+     through the file in chunks, so the host memory needed for
+     staging is bounded by twice the chunk size rather than the full
+     set.
    */
   class VectorIO
   {
     const std::string filename;
 #ifdef HAVE_QIO
     bool parity_inflate;
+    int chunk_size;
 #endif
   public:
 
@@ -22,8 +26,14 @@ namespace quda
        @param[in] filename The filename associated with this IO object
        @param[in] parity_inflate Whether to inflate single_parity
        field to dual parity fields for I/O
+       @param[in] chunk_size Number of vectors staged at a time.  If
+       zero (the default), all vectors are staged at once and saved
+       as a single record, which is the format older versions of QUDA
+       read.  Otherwise each vector is saved as a separate record,
+       which older versions cannot read.  Both formats can be loaded,
+       though a single record file is always staged at once.
     */
-    VectorIO(const std::string &filename, bool parity_inflate = false);
+    VectorIO(const std::string &filename, bool parity_inflate = false, int chunk_size = 0);
 
     /**
        @brief Load vectors from filename
@@ -154,6 +154,7 @@ void printQudaEigParam(QudaEigParam *param) {
 
 #if defined INIT_PARAM
   P(use_eigen_qr, QUDA_BOOLEAN_FALSE);
+  P(use_eigen_arrow, QUDA_BOOLEAN_FALSE);
   P(use_poly_acc, QUDA_BOOLEAN_FALSE);
   P(poly_deg, 0);
   P(a_min, 0.0);
@@ -183,6 +184,7 @@ void printQudaEigParam(QudaEigParam *param) {
   P(mem_type_ritz, QUDA_MEMORY_DEVICE);
 #else
   P(use_eigen_qr, QUDA_BOOLEAN_INVALID);
+  P(use_eigen_arrow, QUDA_BOOLEAN_INVALID);
   P(use_poly_acc, QUDA_BOOLEAN_INVALID);
   P(poly_deg, INVALID_INT);
   P(a_min, INVALID_DOUBLE);
@@ -234,6 +236,12 @@ void printQudaEigParam(QudaEigParam *param) {
   P(io_parity_inflate, QUDA_BOOLEAN_INVALID);
 #endif
 
+#if defined INIT_PARAM
+  P(io_chunk_size, 0);
+#else
+  P(io_chunk_size, INVALID_INT);
+#endif
+
 #ifdef INIT_PARAM
   return ret;
 #endif
@@ -623,6 +631,14 @@ void printQudaInvertParam(QudaInvertParam *param) {
   if (param->chrono_precision == QUDA_INVALID_PRECISION) param->chrono_precision = param->cuda_prec;
 #endif
 
+#if defined INIT_PARAM
+  P(chrono_max_device_dim, 0);
+  P(chrono_spill_pinned, QUDA_BOOLEAN_TRUE);
+#else
+  P(chrono_max_device_dim, INVALID_INT);
+  P(chrono_spill_pinned, QUDA_BOOLEAN_INVALID);
+#endif
+
 #if defined INIT_PARAM
   P(extlib_type, QUDA_EIGEN_EXTLIB);
 #else
@@ -857,6 +873,12 @@ void printQudaMultigridParam(QudaMultigridParam *param) {
 #endif
   }
 
+#ifdef INIT_PARAM
+  P(vec_io_chunk_size, 0);
+#else
+  P(vec_io_chunk_size, INVALID_INT);
+#endif
+
 #ifdef INIT_PARAM
   P(gflops, 0.0);
   P(secs, 0.0);
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <chrono_forecast.h>
+#include <blas_quda.h>
+#include <malloc_quda.h>
+#include <quda_api.h>
+
+namespace quda
+{
+
+  ChronoForecast::ChronoForecast(const ColorSpinorField &meta, int max_dim, QudaPrecision precision, int max_device,
+                                 bool pinned) :
+    max_dim(max_dim), max_device(max_device), pinned(pinned), param(meta), metric(max_dim)
+  {
+    if (max_dim < 1) errorQuda("Invalid chronological basis dimension %d", max_dim);
+    if (max_device < 0) errorQuda("Invalid number of device resident chronological vectors %d", max_device);
+    param.create = QUDA_NULL_FIELD_CREATE;
+    param.location = QUDA_CUDA_FIELD_LOCATION;
+    param.setPrecision(precision, precision, true);
+  }
+
+  ChronoForecast::~ChronoForecast()
+  {
+    for (auto &vec : basis) {
+      if (vec.field) delete vec.field;
+      if (vec.v) host_free(vec.v);
+      if (vec.norm) host_free(vec.norm);
+    }
+  }
+
+  void *ChronoForecast::hostAlloc(size_t bytes) { return pinned ? pinned_malloc(bytes) : safe_malloc(bytes); }
+
+  void ChronoForecast::spill(Vector &vec)
+  {
+    if (!vec.field) return;
+    vec.v = hostAlloc(vec.field->Bytes());
+    qudaMemcpy(vec.v, vec.field->V(), vec.field->Bytes(), cudaMemcpyDeviceToHost);
+    if (vec.field->NormBytes()) {
+      vec.norm = hostAlloc(vec.field->NormBytes());
+      qudaMemcpy(vec.norm, vec.field->Norm(), vec.field->NormBytes(), cudaMemcpyDeviceToHost);
+    }
+    delete vec.field;
+    vec.field = nullptr;
+  }
+
+  void ChronoForecast::restore(Vector &vec, bool copy)
+  {
+    if (vec.field) return;
+    vec.field = ColorSpinorField::Create(param);
+    if (copy) {
+      qudaMemcpy(vec.field->V(), vec.v, vec.field->Bytes(), cudaMemcpyHostToDevice);
+      if (vec.norm) qudaMemcpy(vec.field->Norm(), vec.norm, vec.field->NormBytes(), cudaMemcpyHostToDevice);
+    }
+    host_free(vec.v);
+    vec.v = nullptr;
+    if (vec.norm) host_free(vec.norm);
+    vec.norm = nullptr;
+  }
+
+  void ChronoForecast::push(const ColorSpinorField &x, bool replace_last)
+  {
+    int slot;
+    if (replace_last && size() > 0) {
+      slot = age[0];
+    } else if (size() < max_dim) {
+      slot = size();
+      basis.emplace_back();
+      stale.push_back(true);
+      metric.resize(size());
+      age.insert(age.begin(), slot);
+    } else {
+      // recycle the oldest slot as the newest
+      slot = age.back();
+      std::rotate(age.begin(), age.end() - 1, age.end());
+    }
+
+    // a spilled slot is brought back to the device since it is overwritten
+    restore(basis[slot], false);
+    *basis[slot].field = x;
+    stale[slot] = true;
+
+    if (max_device > 0)
+      for (int i = max_device; i < size(); i++) spill(basis[age[i]]);
+  }
+
+  ColorSpinorField &ChronoForecast::load(int slot, ColorSpinorField &staging, ColorSpinorField *&spilled)
+  {
+    Vector &vec = basis[slot];
+    // device resident in the working precision so use it in place
+    if (vec.field && vec.field->Precision() == staging.Precision()) return *vec.field;
+
+    ColorSpinorField *src = vec.field;
+    if (!src) {
+      if (!spilled) spilled = ColorSpinorField::Create(param);
+      qudaMemcpy(spilled->V(), vec.v, spilled->Bytes(), cudaMemcpyHostToDevice);
+      if (vec.norm) qudaMemcpy(spilled->Norm(), vec.norm, spilled->NormBytes(), cudaMemcpyHostToDevice);
+      src = spilled;
+    }
+    staging = *src;
+    return staging;
+  }
+
+  /*
+    The guess is x = sum_j a_j v_j, minimizing the A-norm of the error
+    (hermitian) or the residual norm (otherwise) over the span of the
+    stored solutions v_j.  Each stored vector is expanded into the
+    working precision once, so a spilled vector is copied to the device
+    once per forecast, and all inner products are multi-reductions over
+    the expanded set V:
+
+    1. For each j, apply the operator q_j = A v_j.  In the Hermitian
+       case H_ij = (v_i, q_j) for i <= j is formed at once, H being
+       Hermitian this gives it in full, and q_j is discarded.  For the
+       normal equations the q_j are kept, and H_ij = (q_i, q_j) and
+       phi_i = (q_i, b) are formed in one reduction at the end.
+    2. Form the columns of G_ij = (v_i, v_j) of the vectors pushed since
+       the last forecast, together with phi_i = (v_i, b) in the
+       Hermitian case, in one reduction, and update those rows of the
+       metric
+    3. Solve H a = phi in the basis orthonormalized by G
+    4. x = sum_j a_j v_j
+  */
+  void ChronoForecast::operator()(ColorSpinorField &x, const ColorSpinorField &b, const DiracMatrix &mat,
+                                  QudaPrecision precision, bool hermitian, TimeProfile &profile)
+  {
+    bool running = profile.isRunning(QUDA_PROFILE_CHRONO);
+    if (!running) profile.TPSTART(QUDA_PROFILE_CHRONO);
+
+    const int N = size();
+
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Constructing chronological forecast with basis size %d in precision %d from storage precision %d\n",
+                 N, precision, Precision());
+
+    if (N == 0) {
+      blas::zero(x);
+      if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
+      return;
+    }
+
+    ColorSpinorParam work_param(param);
+    work_param.setPrecision(precision, precision, true);
+    ColorSpinorField *q = ColorSpinorField::Create(work_param);
+    ColorSpinorField *tmp = ColorSpinorField::Create(work_param);
+    ColorSpinorField *tmp2 = ColorSpinorField::Create(work_param);
+    ColorSpinorField *bw = ColorSpinorField::Create(work_param);
+    ColorSpinorField *spilled = nullptr;
+    blas::copy(*bw, b);
+
+    // the basis in the working precision: resident vectors already in it are used in place
+    std::vector<ColorSpinorField *> V(N), staging, Q;
+    for (int j = 0; j < N; j++) {
+      if (!basis[j].field || basis[j].field->Precision() != precision) {
+        staging.push_back(ColorSpinorField::Create(work_param));
+        V[j] = &load(j, *staging.back(), spilled);
+      } else {
+        V[j] = basis[j].field;
+      }
+    }
+    if (spilled) delete spilled;
+
+    std::vector<Complex> H(N * N), phi(N), alpha(N);
+
+    for (int j = 0; j < N; j++) {
+      if (!hermitian) Q.push_back(ColorSpinorField::Create(work_param));
+      ColorSpinorField &qj = hermitian ? *q : *Q[j];
+      mat(qj, *V[j], *tmp, *tmp2);
+
+      if (hermitian) {
+        // (v_i, q_j) for i <= j in a single reduction
+        std::vector<ColorSpinorField *> Vj(V.begin(), V.begin() + j + 1), Y {&qj};
+        std::vector<Complex> h(j + 1);
+        blas::cDotProduct(h.data(), Vj, Y);
+        for (int i = 0; i <= j; i++) {
+          H[i * N + j] = h[i];
+          H[j * N + i] = std::conj(h[i]);
+        }
+        H[j * N + j] = h[j];
+      }
+    }
+
+    if (!hermitian) {
+      // form the Nx(N+1) matrix [H phi] using only a single reduction
+      std::vector<ColorSpinorField *> Qb(Q);
+      Qb.push_back(bw);
+      std::vector<Complex> Hphi(N * (N + 1));
+      blas::cDotProduct(Hphi.data(), Q, Qb);
+      for (int i = 0; i < N; i++) {
+        phi[i] = Hphi[i * (N + 1) + N];
+        for (int j = 0; j < N; j++) H[i * N + j] = Hphi[i * (N + 1) + j];
+      }
+      for (auto qj : Q) delete qj;
+    }
+
+    // the stale columns of G, with phi in the Hermitian case, in a single reduction
+    std::vector<int> rows;
+    std::vector<ColorSpinorField *> Y;
+    if (hermitian) Y.push_back(bw);
+    for (int k = 0; k < N; k++)
+      if (stale[k]) {
+        rows.push_back(k);
+        Y.push_back(V[k]);
+      }
+
+    if (Y.size() > 0) {
+      const int offset = hermitian ? 1 : 0;
+      const int n_y = static_cast<int>(Y.size());
+      std::vector<Complex> VY(N * n_y);
+      blas::cDotProduct(VY.data(), V, Y);
+      if (hermitian)
+        for (int i = 0; i < N; i++) phi[i] = VY[i * n_y];
+
+      // only the rows of vectors pushed since the last forecast are updated
+      std::vector<Complex> G(N); // row k of the metric, G_ki = (v_k, v_i)
+      for (unsigned int s = 0; s < rows.size(); s++) {
+        const int k = rows[s];
+        for (int i = 0; i < N; i++) G[i] = std::conj(VY[i * n_y + offset + s]);
+        metric.update(k, G.data());
+        stale[k] = false;
+      }
+    }
+
+    chronoProjection(alpha.data(), metric, H.data(), phi.data());
+
+    blas::zero(x);
+    std::vector<ColorSpinorField *> X {&x};
+    blas::caxpy(alpha.data(), V, X);
+
+    if (getVerbosity() >= QUDA_SUMMARIZE) {
+      // compute the residual only if we're going to print it
+      double b2 = blas::norm2(*bw);
+      ColorSpinorField *xw = ColorSpinorField::Create(work_param);
+      blas::copy(*xw, x);
+      mat(*q, *xw, *tmp, *tmp2);
+      delete xw;
+      double rsd = sqrt(blas::xmyNorm(*bw, *q) / b2);
+      printfQuda("ChronoForecast: N = %d, |res| / |src| = %e\n", N, rsd);
+    }
+
+    for (auto v : staging) delete v;
+    delete bw;
+    delete tmp2;
+    delete tmp;
+    delete q;
+
+    if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
+  }
+
+} // namespace quda
@@ -605,6 +605,7 @@ MsgHandle *comm_declare_strided_receive_relative_(const char *func, const char *
 
 void comm_finalize(void)
 {
+  comm_handle_cache_free();
   Topology *topo = comm_default_topology();
   comm_destroy_topology(topo);
   comm_set_default_topology(NULL);
@@ -3,6 +3,9 @@
 #include <cstring>
 #include <algorithm>
 #include <numeric>
+#include <map>
+#include <tuple>
+#include <vector>
 #include <mpi.h>
 #include <quda_internal.h>
 #include <comm_quda.h>
@@ -33,10 +36,24 @@ struct MsgHandle_s {
   MPI_Datatype datatype;
 
   /**
-     Whether a custom datatype has been created or not.  Used to
-     determine whether we need to free the datatype or not.
+     Whether a custom (strided) datatype is used or not.  The
+     datatype itself is owned by the datatype cache, so it is not
+     freed when the handle is freed.
    */
   bool custom;
+
+  /**
+     Whether this handle is owned by the persistent handle cache.
+     Cached handles are returned to the cache by comm_free rather than
+     being freed.
+   */
+  bool cached;
+
+  /**
+     Whether this handle is presently checked out of the cache
+     (between a comm_declare_* and the matching comm_free).
+   */
+  bool active;
 };
 
 static int rank = -1;
@@ -100,116 +117,211 @@ static void check_displacement(const int displacement[], int ndim) {
 }
 
 /**
- * Declare a message handle for sending to a node displaced in (x,y,z,t) according to "displacement"
+   Compute the message tag for a given displacement.  Sends and
+   receives use mirrored displacements so that a send to +mu matches
+   the receive from -mu on the neighboring process.
+   @param displacement Displacement of the remote process
+   @param ndim Number of dimensions
+   @param send Whether this is for a send or a receive
+   @return Message tag
  */
-MsgHandle *comm_declare_send_displaced(void *buffer, const int displacement[], size_t nbytes)
+static int displacement_tag(const int displacement[], int ndim, bool send)
 {
-  Topology *topo = comm_default_topology();
-  int ndim = comm_ndim(topo);
-  check_displacement(displacement, ndim);
-
-  int rank = comm_rank_displaced(topo, displacement);
-
   int tag = 0;
-  for (int i=ndim-1; i>=0; i--) tag = tag * 4 * max_displacement + displacement[i] + max_displacement;
-  tag = tag >= 0 ? tag : 2*pow(4*max_displacement,ndim) + tag;
-
-  MsgHandle *mh = (MsgHandle *)safe_malloc(sizeof(MsgHandle));
-  MPI_CHECK(MPI_Send_init(buffer, nbytes, MPI_BYTE, rank, tag, MPI_COMM_HANDLE, &(mh->request)));
-  mh->custom = false;
-
-  return mh;
+  for (int i = ndim - 1; i >= 0; i--)
+    tag = tag * 4 * max_displacement + (send ? displacement[i] : -displacement[i]) + max_displacement;
+  tag = tag >= 0 ? tag : 2 * pow(4 * max_displacement, ndim) + tag;
+  return tag;
 }
 
-
 /**
- * Declare a message handle for receiving from a node displaced in (x,y,z,t) according to "displacement"
+   Cache of committed strided datatypes, keyed by (blksize, nblocks,
+   stride).  Datatypes are independent of the buffer, so these live
+   until comm_handle_cache_free() is called.
  */
-MsgHandle *comm_declare_receive_displaced(void *buffer, const int displacement[], size_t nbytes)
+using datatype_key_t = std::tuple<size_t, int, size_t>;
+static std::map<datatype_key_t, MPI_Datatype> datatype_cache;
+
+static MPI_Datatype get_strided_datatype(size_t blksize, int nblocks, size_t stride)
 {
-  Topology *topo = comm_default_topology();
-  int ndim = comm_ndim(topo);
-  check_displacement(displacement,ndim);
+  auto key = std::make_tuple(blksize, nblocks, stride);
+  auto it = datatype_cache.find(key);
+  if (it != datatype_cache.end()) return it->second;
 
-  int rank = comm_rank_displaced(topo, displacement);
+  MPI_Datatype datatype;
+  MPI_CHECK(MPI_Type_vector(nblocks, blksize, stride, MPI_BYTE, &datatype));
+  MPI_CHECK(MPI_Type_commit(&datatype));
+  datatype_cache[key] = datatype;
+  return datatype;
+}
 
-  int tag = 0;
-  for (int i=ndim-1; i>=0; i--) tag = tag * 4 * max_displacement - displacement[i] + max_displacement;
-  tag = tag >= 0 ? tag : 2*pow(4*max_displacement,ndim) + tag;
+/**
+   Memory regions registered for persistent handle caching.  Only
+   handles whose buffer lies within a registered region are cached,
+   since the region owner guarantees to invalidate the cache before
+   the memory is released.
+ */
+static std::vector<std::pair<char *, size_t>> cache_regions;
 
-  MsgHandle *mh = (MsgHandle *)safe_malloc(sizeof(MsgHandle));
-  MPI_CHECK(MPI_Recv_init(buffer, nbytes, MPI_BYTE, rank, tag, MPI_COMM_HANDLE, &(mh->request)));
-  mh->custom = false;
+/**
+   Cache of persistent requests, keyed by (send/receive, buffer,
+   remote rank, tag, nbytes / blksize, nblocks, stride).  A
+   contiguous message is stored with nblocks = 0.
+ */
+using handle_key_t = std::tuple<bool, void *, int, int, size_t, int, size_t>;
+static std::map<handle_key_t, MsgHandle *> handle_cache;
 
-  return mh;
+static bool cache_region_contains(void *buffer)
+{
+  for (auto &region : cache_regions) {
+    if (static_cast<char *>(buffer) >= region.first && static_cast<char *>(buffer) < region.first + region.second)
+      return true;
+  }
+  return false;
 }
 
+static void free_handle(MsgHandle *mh)
+{
+  MPI_CHECK(MPI_Request_free(&(mh->request)));
+  host_free(mh);
+}
 
 /**
- * Declare a message handle for sending to a node displaced in (x,y,z,t) according to "displacement"
+   Declare a persistent message handle, returning a previously
+   declared one from the cache if one is available.
+   @param send Whether this is a send or a receive
+   @param buffer Buffer to send from / receive into
+   @param displacement Displacement of the remote process
+   @param blksize Size of block in bytes (total bytes if contiguous)
+   @param nblocks Number of blocks (zero if contiguous)
+   @param stride Stride between blocks in bytes
  */
-MsgHandle *comm_declare_strided_send_displaced(void *buffer, const int displacement[],
-					       size_t blksize, int nblocks, size_t stride)
+static MsgHandle *declare_displaced(bool send, void *buffer, const int displacement[], size_t blksize, int nblocks,
+                                    size_t stride)
 {
   Topology *topo = comm_default_topology();
   int ndim = comm_ndim(topo);
   check_displacement(displacement, ndim);
 
   int rank = comm_rank_displaced(topo, displacement);
-
-  int tag = 0;
-  for (int i=ndim-1; i>=0; i--) tag = tag * 4 * max_displacement + displacement[i] + max_displacement;
-  tag = tag >= 0 ? tag : 2*pow(4*max_displacement,ndim) + tag;
+  int tag = displacement_tag(displacement, ndim, send);
+
+  bool cacheable = cache_region_contains(buffer);
+  auto key = std::make_tuple(send, buffer, rank, tag, blksize, nblocks, stride);
+  if (cacheable) {
+    auto it = handle_cache.find(key);
+    // if the cached handle is presently in use we fall back to an uncached one
+    if (it != handle_cache.end() && !it->second->active) {
+      it->second->active = true;
+      return it->second;
+    }
+  }
 
   MsgHandle *mh = (MsgHandle *)safe_malloc(sizeof(MsgHandle));
+  mh->custom = nblocks > 0;
+  mh->datatype = mh->custom ? get_strided_datatype(blksize, nblocks, stride) : MPI_BYTE;
+  int count = mh->custom ? 1 : blksize;
 
-  // create a new strided MPI type
-  MPI_CHECK( MPI_Type_vector(nblocks, blksize, stride, MPI_BYTE, &(mh->datatype)) );
-  MPI_CHECK( MPI_Type_commit(&(mh->datatype)) );
-  mh->custom = true;
+  if (send) {
+    MPI_CHECK(MPI_Send_init(buffer, count, mh->datatype, rank, tag, MPI_COMM_HANDLE, &(mh->request)));
+  } else {
+    MPI_CHECK(MPI_Recv_init(buffer, count, mh->datatype, rank, tag, MPI_COMM_HANDLE, &(mh->request)));
+  }
 
-  MPI_CHECK(MPI_Send_init(buffer, 1, mh->datatype, rank, tag, MPI_COMM_HANDLE, &(mh->request)));
+  mh->cached = cacheable && handle_cache.find(key) == handle_cache.end();
+  mh->active = true;
+  if (mh->cached) handle_cache[key] = mh;
 
   return mh;
 }
 
-
 /**
- * Declare a message handle for receiving from a node displaced in (x,y,z,t) according to "displacement"
+ * Declare a message handle for sending to a node displaced in (x,y,z,t) according to "displacement"
  */
-MsgHandle *comm_declare_strided_receive_displaced(void *buffer, const int displacement[],
-						  size_t blksize, int nblocks, size_t stride)
+MsgHandle *comm_declare_send_displaced(void *buffer, const int displacement[], size_t nbytes)
 {
-  Topology *topo = comm_default_topology();
-  int ndim = comm_ndim(topo);
-  check_displacement(displacement,ndim);
+  return declare_displaced(true, buffer, displacement, nbytes, 0, 0);
+}
 
-  int rank = comm_rank_displaced(topo, displacement);
 
-  int tag = 0;
-  for (int i=ndim-1; i>=0; i--) tag = tag * 4 * max_displacement - displacement[i] + max_displacement;
-  tag = tag >= 0 ? tag : 2*pow(4*max_displacement,ndim) + tag;
+/**
+ * Declare a message handle for receiving from a node displaced in (x,y,z,t) according to "displacement"
+ */
+MsgHandle *comm_declare_receive_displaced(void *buffer, const int displacement[], size_t nbytes)
+{
+  return declare_displaced(false, buffer, displacement, nbytes, 0, 0);
+}
 
-  MsgHandle *mh = (MsgHandle *)safe_malloc(sizeof(MsgHandle));
 
-  // create a new strided MPI type
-  MPI_CHECK( MPI_Type_vector(nblocks, blksize, stride, MPI_BYTE, &(mh->datatype)) );
-  MPI_CHECK( MPI_Type_commit(&(mh->datatype)) );
-  mh->custom = true;
+/**
+ * Declare a message handle for sending to a node displaced in (x,y,z,t) according to "displacement"
+ */
+MsgHandle *comm_declare_strided_send_displaced(void *buffer, const int displacement[],
+					       size_t blksize, int nblocks, size_t stride)
+{
+  return declare_displaced(true, buffer, displacement, blksize, nblocks, stride);
+}
 
-  MPI_CHECK(MPI_Recv_init(buffer, 1, mh->datatype, rank, tag, MPI_COMM_HANDLE, &(mh->request)));
 
-  return mh;
+/**
+ * Declare a message handle for receiving from a node displaced in (x,y,z,t) according to "displacement"
+ */
+MsgHandle *comm_declare_strided_receive_displaced(void *buffer, const int displacement[],
+						  size_t blksize, int nblocks, size_t stride)
+{
+  return declare_displaced(false, buffer, displacement, blksize, nblocks, stride);
 }
 
 void comm_free(MsgHandle *&mh)
 {
-  MPI_CHECK(MPI_Request_free(&(mh->request)));
-  if (mh->custom) MPI_CHECK(MPI_Type_free(&(mh->datatype)));
-  host_free(mh);
+  if (mh->cached) {
+    mh->active = false; // return the handle to the cache
+  } else {
+    free_handle(mh);
+  }
   mh = nullptr;
 }
 
+void comm_handle_cache_register(void *buffer, size_t nbytes)
+{
+  if (!buffer || nbytes == 0) return;
+  comm_handle_cache_invalidate(buffer);
+  cache_regions.push_back(std::make_pair(static_cast<char *>(buffer), nbytes));
+}
+
+void comm_handle_cache_invalidate(void *buffer)
+{
+  auto region = std::find_if(cache_regions.begin(), cache_regions.end(),
+                             [buffer](const std::pair<char *, size_t> &r) { return r.first == buffer; });
+  if (region == cache_regions.end()) return;
+
+  char *begin = region->first;
+  char *end = region->first + region->second;
+  cache_regions.erase(region);
+
+  for (auto it = handle_cache.begin(); it != handle_cache.end();) {
+    char *ptr = static_cast<char *>(std::get<1>(it->first));
+    if (ptr >= begin && ptr < end) {
+      MsgHandle *mh = it->second;
+      if (mh->active) {
+        mh->cached = false; // still held by a field, so detach and let comm_free release it
+      } else {
+        free_handle(mh);
+      }
+      it = handle_cache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void comm_handle_cache_free()
+{
+  while (cache_regions.size() > 0) comm_handle_cache_invalidate(cache_regions.back().first);
+  for (auto &entry : datatype_cache) MPI_CHECK(MPI_Type_free(&entry.second));
+  datatype_cache.clear();
+}
+
 
 void comm_start(MsgHandle *mh)
 {
@@ -202,6 +202,13 @@ void comm_free(MsgHandle *&mh)
   mh = nullptr;
 }
 
+// QMP message handles are not cached: these are no-ops
+void comm_handle_cache_register(void *buffer, size_t nbytes) {}
+
+void comm_handle_cache_invalidate(void *buffer) {}
+
+void comm_handle_cache_free() {}
+
 
 void comm_start(MsgHandle *mh)
 {
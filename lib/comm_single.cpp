@@ -39,6 +39,12 @@ MsgHandle *comm_declare_strided_receive_displaced(void *buffer, const int displa
 
 void comm_free(MsgHandle *&mh) {}
 
+void comm_handle_cache_register(void *buffer, size_t nbytes) {}
+
+void comm_handle_cache_invalidate(void *buffer) {}
+
+void comm_handle_cache_free() {}
+
 void comm_start(MsgHandle *mh) {}
 
 void comm_wait(MsgHandle *mh) {}
@@ -274,6 +274,11 @@ namespace quda {
 	backGhostFaceBuffer[i] = safe_malloc(ghostFaceBytes[i]);
 	fwdGhostFaceSendBuffer[i] = safe_malloc(ghostFaceBytes[i]);
 	backGhostFaceSendBuffer[i] = safe_malloc(ghostFaceBytes[i]);
+
+        comm_handle_cache_register(fwdGhostFaceBuffer[i], ghostFaceBytes[i]);
+        comm_handle_cache_register(backGhostFaceBuffer[i], ghostFaceBytes[i]);
+        comm_handle_cache_register(fwdGhostFaceSendBuffer[i], ghostFaceBytes[i]);
+        comm_handle_cache_register(backGhostFaceSendBuffer[i], ghostFaceBytes[i]);
       }
       initGhostFaceBuffer = 1;
     }
@@ -285,6 +290,10 @@ namespace quda {
     if(!initGhostFaceBuffer) return;
 
     for(int i=0; i < 4; i++){  // make nDimComms static?
+      comm_handle_cache_invalidate(fwdGhostFaceBuffer[i]);
+      comm_handle_cache_invalidate(backGhostFaceBuffer[i]);
+      comm_handle_cache_invalidate(fwdGhostFaceSendBuffer[i]);
+      comm_handle_cache_invalidate(backGhostFaceSendBuffer[i]);
       host_free(fwdGhostFaceBuffer[i]); fwdGhostFaceBuffer[i] = NULL;
       host_free(backGhostFaceBuffer[i]); backGhostFaceBuffer[i] = NULL;
       host_free(fwdGhostFaceSendBuffer[i]); fwdGhostFaceSendBuffer[i] = NULL;
@@ -311,11 +320,18 @@ namespace quda {
   void cpuColorSpinorField::exchangeGhost(QudaParity parity, int nFace, int dagger, const MemoryLocation *dummy1,
 					  const MemoryLocation *dummy2, bool dummy3, bool dummy4, QudaPrecision dummy5) const
   {
+    exchangeGhostStart(parity, nFace, dagger);
+    exchangeGhostWait();
+  }
+
+  void cpuColorSpinorField::exchangeGhostStart(QudaParity parity, int nFace, int dagger) const
+  {
+    if (ghost_exchange_active) errorQuda("Ghost exchange already in progress");
+
     // allocate ghost buffer if not yet allocated
     allocateGhostBuffer(nFace);
 
-    void **sendbuf = static_cast<void**>(safe_malloc(nDimComms * 2 * sizeof(void*)));
-
+    void *sendbuf[2 * QUDA_MAX_DIM];
     for (int i=0; i<nDimComms; i++) {
       sendbuf[2*i + 0] = backGhostFaceSendBuffer[i];
       sendbuf[2*i + 1] = fwdGhostFaceSendBuffer[i];
@@ -325,9 +341,37 @@ namespace quda {
 
     packGhost(sendbuf, parity, nFace, dagger);
 
-    exchange(ghost_buf, sendbuf, nFace);
+    // the ghost buffers are registered with the message handle cache, so these declarations are cheap
+    const int Ninternal = 2*nColor*nSpin;
+    for (int i=0; i<nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      size_t bytes = siteSubset*nFace*surfaceCB[i]*Ninternal*ghost_precision;
+      mh_ghost_recv[2*i + 0] = comm_declare_receive_relative(ghost_buf[2*i + 0], i, -1, bytes);
+      mh_ghost_recv[2*i + 1] = comm_declare_receive_relative(ghost_buf[2*i + 1], i, +1, bytes);
+      mh_ghost_send[2*i + 0] = comm_declare_send_relative(sendbuf[2*i + 0], i, -1, bytes);
+      mh_ghost_send[2*i + 1] = comm_declare_send_relative(sendbuf[2*i + 1], i, +1, bytes);
+    }
+
+    // post all receives before any of the sends
+    for (int i=0; i<2*nDimComms; i++) if (comm_dim_partitioned(i/2)) comm_start(mh_ghost_recv[i]);
+    for (int i=0; i<2*nDimComms; i++) if (comm_dim_partitioned(i/2)) comm_start(mh_ghost_send[i]);
+
+    ghost_exchange_active = true;
+  }
+
+  void cpuColorSpinorField::exchangeGhostWait() const
+  {
+    if (!ghost_exchange_active) errorQuda("No ghost exchange in progress");
+
+    for (int i=0; i<2*nDimComms; i++) {
+      if (!comm_dim_partitioned(i/2)) continue;
+      comm_wait(mh_ghost_send[i]);
+      comm_wait(mh_ghost_recv[i]);
+      comm_free(mh_ghost_send[i]);
+      comm_free(mh_ghost_recv[i]);
+    }
 
-    host_free(sendbuf);
+    ghost_exchange_active = false;
   }
 
 } // namespace quda
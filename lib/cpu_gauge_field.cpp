@@ -146,17 +146,20 @@ namespace quda {
       if (geometry == QUDA_COARSE_GEOMETRY) send[d+4] = safe_malloc(nFace*surface[d]*nInternal*precision);
     }
 
-    if (link_direction == QUDA_LINK_BACKWARDS || link_direction == QUDA_LINK_BIDIRECTIONAL) {
+    if (link_direction == QUDA_LINK_BIDIRECTIONAL) {
+      // get both sets of links into contiguous buffers and communicate them concurrently
+      // (the ghost accessor indexes by dimension only, so offset the buffers for the forward links)
+      extractGaugeGhost(*this, send, true);
+      extractGaugeGhost(*this, send + nDim, true, nDim);
+      exchange(ghost, send, QUDA_FORWARDS, 2);
+    } else if (link_direction == QUDA_LINK_BACKWARDS) {
       // get the links into contiguous buffers
       extractGaugeGhost(*this, send, true);
 
       // communicate between nodes
       exchange(ghost, send, QUDA_FORWARDS);
-    }
-
-    // repeat if requested and links are bi-directional
-    if (link_direction == QUDA_LINK_FORWARDS || link_direction == QUDA_LINK_BIDIRECTIONAL) {
-      extractGaugeGhost(*this, send, true, nDim);
+    } else if (link_direction == QUDA_LINK_FORWARDS) {
+      extractGaugeGhost(*this, send + nDim, true, nDim);
       exchange(ghost+nDim, send+nDim, QUDA_FORWARDS);
     }
 
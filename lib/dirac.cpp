@@ -11,6 +11,7 @@ namespace quda {
 
   Dirac::Dirac(const DiracParam &param) :
     gauge(param.gauge),
+    gauge_h(param.gauge_h),
     kappa(param.kappa),
     mass(param.mass),
     laplace3D(param.laplace3D),
@@ -28,6 +29,7 @@ namespace quda {
 
   Dirac::Dirac(const Dirac &dirac) :
     gauge(dirac.gauge),
+    gauge_h(dirac.gauge_h),
     kappa(dirac.kappa),
     laplace3D(dirac.laplace3D),
     matpcType(dirac.matpcType),
@@ -52,6 +54,7 @@ namespace quda {
   {
     if (&dirac != this) {
       gauge = dirac.gauge;
+      gauge_h = dirac.gauge_h;
       kappa = dirac.kappa;
       laplace3D = dirac.laplace3D;
       matpcType = dirac.matpcType;
@@ -87,6 +90,16 @@ namespace quda {
     }
   }
 
+  const GaugeField &Dirac::gaugeField(const ColorSpinorField &a) const
+  {
+    if (a.Location() == QUDA_CPU_FIELD_LOCATION) {
+      if (!gauge_h) errorQuda("Host gauge field required to apply the operator to host fields");
+      return *gauge_h;
+    }
+    if (!gauge) errorQuda("Device gauge field required to apply the operator to device fields");
+    return *gauge;
+  }
+
 #define flip(x) (x) = ((x) == QUDA_DAG_YES ? QUDA_DAG_NO : QUDA_DAG_YES)
 
   void Dirac::Mdag(ColorSpinorField &out, const ColorSpinorField &in) const
@@ -118,19 +131,22 @@ namespace quda {
 		in.SiteSubset(), out.SiteSubset());
     }
 
-    if (!static_cast<const cudaColorSpinorField&>(in).isNative()) errorQuda("Input field is not in native order");
-    if (!static_cast<const cudaColorSpinorField&>(out).isNative()) errorQuda("Output field is not in native order");
+    if (in.Location() == QUDA_CUDA_FIELD_LOCATION) {
+      if (!in.isNative()) errorQuda("Input field is not in native order");
+      if (!out.isNative()) errorQuda("Output field is not in native order");
+    }
 
+    const GaugeField &U = gaugeField(out);
     if (out.Ndim() != 5) {
-      if ((out.Volume() != gauge->Volume() && out.SiteSubset() == QUDA_FULL_SITE_SUBSET) ||
-	  (out.Volume() != gauge->VolumeCB() && out.SiteSubset() == QUDA_PARITY_SITE_SUBSET) ) {
-        errorQuda("Spinor volume %lu doesn't match gauge volume %lu", out.Volume(), gauge->VolumeCB());
+      if ((out.Volume() != U.Volume() && out.SiteSubset() == QUDA_FULL_SITE_SUBSET) ||
+	  (out.Volume() != U.VolumeCB() && out.SiteSubset() == QUDA_PARITY_SITE_SUBSET) ) {
+        errorQuda("Spinor volume %lu doesn't match gauge volume %lu", out.Volume(), U.VolumeCB());
       }
     } else {
       // Domain wall fermions, compare 4d volumes not 5d
-      if ((out.Volume()/out.X(4) != gauge->Volume() && out.SiteSubset() == QUDA_FULL_SITE_SUBSET) ||
-	  (out.Volume()/out.X(4) != gauge->VolumeCB() && out.SiteSubset() == QUDA_PARITY_SITE_SUBSET) ) {
-        errorQuda("Spinor volume %lu doesn't match gauge volume %lu", out.Volume(), gauge->VolumeCB());
+      if ((out.Volume()/out.X(4) != U.Volume() && out.SiteSubset() == QUDA_FULL_SITE_SUBSET) ||
+	  (out.Volume()/out.X(4) != U.VolumeCB() && out.SiteSubset() == QUDA_PARITY_SITE_SUBSET) ) {
+        errorQuda("Spinor volume %lu doesn't match gauge volume %lu", out.Volume(), U.VolumeCB());
       }
     }
   }
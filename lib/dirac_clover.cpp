@@ -4,9 +4,19 @@
 
 namespace quda {
 
-  DiracClover::DiracClover(const DiracParam &param) : DiracWilson(param), clover(param.clover) {}
+  DiracClover::DiracClover(const DiracParam &param) :
+    DiracWilson(param),
+    clover(param.clover),
+    clover_h(param.clover_h)
+  {
+  }
 
-  DiracClover::DiracClover(const DiracClover &dirac) : DiracWilson(dirac), clover(dirac.clover) {}
+  DiracClover::DiracClover(const DiracClover &dirac) :
+    DiracWilson(dirac),
+    clover(dirac.clover),
+    clover_h(dirac.clover_h)
+  {
+  }
 
   DiracClover::~DiracClover() { }
 
@@ -15,16 +25,28 @@ namespace quda {
     if (&dirac != this) {
       DiracWilson::operator=(dirac);
       clover = dirac.clover;
+      clover_h = dirac.clover_h;
     }
     return *this;
   }
 
+  const CloverField &DiracClover::cloverField(const ColorSpinorField &a) const
+  {
+    if (a.Location() == QUDA_CPU_FIELD_LOCATION) {
+      if (!clover_h) errorQuda("Host clover field required to apply the operator to host fields");
+      return *clover_h;
+    }
+    if (!clover) errorQuda("Device clover field required to apply the operator to device fields");
+    return *clover;
+  }
+
   void DiracClover::checkParitySpinor(const ColorSpinorField &out, const ColorSpinorField &in) const
   {
     Dirac::checkParitySpinor(out, in);
 
-    if (out.Volume() != clover->VolumeCB()) {
-      errorQuda("Parity spinor volume %lu doesn't match clover checkboard volume %lu", out.Volume(), clover->VolumeCB());
+    if (out.Volume() != cloverField(out).VolumeCB()) {
+      errorQuda("Parity spinor volume %lu doesn't match clover checkboard volume %lu", out.Volume(),
+                cloverField(out).VolumeCB());
     }
   }
 
@@ -36,7 +58,7 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilsonClover(out, in, *gauge, *clover, k, x, parity, dagger, commDim, profile);
+    ApplyWilsonClover(out, in, gaugeField(in), cloverField(in), k, x, parity, dagger, commDim, profile);
     flops += 1872ll*in.Volume();
   }
 
@@ -45,13 +67,14 @@ namespace quda {
   {
     checkParitySpinor(in, out);
 
-    ApplyClover(out, in, *clover, false, parity);
+    ApplyClover(out, in, cloverField(in), false, parity);
     flops += 504ll*in.Volume();
   }
 
   void DiracClover::M(ColorSpinorField &out, const ColorSpinorField &in) const
   {
-    ApplyWilsonClover(out, in, *gauge, *clover, -kappa, in, QUDA_INVALID_PARITY, dagger, commDim, profile);
+    ApplyWilsonClover(out, in, gaugeField(in), cloverField(in), -kappa, in, QUDA_INVALID_PARITY, dagger, commDim,
+                      profile);
     flops += 1872ll * in.Volume();
   }
 
@@ -98,7 +121,7 @@ namespace quda {
   void DiracClover::prefetch(QudaFieldLocation mem_space, qudaStream_t stream) const
   {
     Dirac::prefetch(mem_space, stream);
-    clover->prefetch(mem_space, stream, CloverPrefetchType::CLOVER_CLOVER_PREFETCH_TYPE);
+    if (clover) clover->prefetch(mem_space, stream, CloverPrefetchType::CLOVER_CLOVER_PREFETCH_TYPE);
   }
 
   /*******
@@ -108,7 +131,8 @@ namespace quda {
     DiracClover(param)
   {
     // For the preconditioned operator, we need to check that the inverse of the clover term is present
-    if (!clover->cloverInv) errorQuda("Clover inverse required for DiracCloverPC");
+    if (clover && !clover->cloverInv) errorQuda("Clover inverse required for DiracCloverPC");
+    if (clover_h && !clover_h->V(true)) errorQuda("Host clover inverse required for DiracCloverPC");
   }
 
   DiracCloverPC::DiracCloverPC(const DiracCloverPC &dirac) : DiracClover(dirac) { }
@@ -129,7 +153,7 @@ namespace quda {
   {
     checkParitySpinor(in, out);
 
-    ApplyClover(out, in, *clover, true, parity);
+    ApplyClover(out, in, cloverField(in), true, parity);
     flops += 504ll*in.Volume();
   }
 
@@ -142,7 +166,8 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilsonCloverPreconditioned(out, in, *gauge, *clover, 0.0, in, parity, dagger, commDim, profile);
+    ApplyWilsonCloverPreconditioned(out, in, gaugeField(in), cloverField(in), 0.0, in, parity, dagger, commDim,
+                                    profile);
     flops += 1824ll*in.Volume();
   }
 
@@ -154,7 +179,7 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilsonCloverPreconditioned(out, in, *gauge, *clover, k, x, parity, dagger, commDim, profile);
+    ApplyWilsonCloverPreconditioned(out, in, gaugeField(in), cloverField(in), k, x, parity, dagger, commDim, profile);
     flops += 1872ll*in.Volume();
   }
 
@@ -306,6 +331,7 @@ namespace quda {
   void DiracCloverPC::prefetch(QudaFieldLocation mem_space, qudaStream_t stream) const
   {
     Dirac::prefetch(mem_space, stream);
+    if (!clover) return;
 
     bool symmetric = (matpcType == QUDA_MATPC_EVEN_EVEN || matpcType == QUDA_MATPC_ODD_ODD) ? true : false;
     int odd_bit = (matpcType == QUDA_MATPC_ODD_ODD || matpcType == QUDA_MATPC_ODD_ODD_ASYMMETRIC) ? 1 : 0;
@@ -57,7 +57,7 @@ namespace quda {
     gpu_setup(true),
     init_gpu(enable_gpu ? false : true),
     init_cpu(enable_cpu ? false : true),
-    mapped(Y_d->MemType() == QUDA_MEMORY_MAPPED)
+    mapped(Y_d ? Y_d->MemType() == QUDA_MEMORY_MAPPED : false)
   {
 
   }
@@ -28,7 +28,7 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilson(out, in, *gauge, 0.0, in, parity, dagger, commDim, profile);
+    ApplyWilson(out, in, gaugeField(in), 0.0, in, parity, dagger, commDim, profile);
     flops += 1320ll*in.Volume();
   }
 
@@ -39,7 +39,7 @@ namespace quda {
     checkParitySpinor(in, out);
     checkSpinorAlias(in, out);
 
-    ApplyWilson(out, in, *gauge, k, x, parity, dagger, commDim, profile);
+    ApplyWilson(out, in, gaugeField(in), k, x, parity, dagger, commDim, profile);
     flops += 1368ll*in.Volume();
   }
 
@@ -47,7 +47,7 @@ namespace quda {
   {
     checkFullSpinor(out, in);
 
-    ApplyWilson(out, in, *gauge, -kappa, in, QUDA_INVALID_PARITY, dagger, commDim, profile);
+    ApplyWilson(out, in, gaugeField(in), -kappa, in, QUDA_INVALID_PARITY, dagger, commDim, profile);
     flops += 1368ll * in.Volume();
   }
 
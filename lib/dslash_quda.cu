@@ -529,6 +529,10 @@ namespace quda {
   //out(x) = clover*in
   void ApplyClover(ColorSpinorField &out, const ColorSpinorField &in, const CloverField &clover, bool inverse, int parity)
   {
+    if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
+      ApplyCloverCPU(out, in, clover, inverse, parity);
+      return;
+    }
 #ifdef GPU_CLOVER_DIRAC
     instantiate<Clover>(out, in, clover, inverse, parity);
 #else
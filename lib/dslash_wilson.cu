@@ -52,6 +52,10 @@ namespace quda
   void ApplyWilson(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
                    const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
   {
+    if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
+      ApplyWilsonCPU(out, in, U, a, x, parity, dagger, comm_override);
+      return;
+    }
 #ifdef GPU_WILSON_DIRAC
     instantiate<WilsonApply, WilsonReconstruct>(out, in, U, a, x, parity, dagger, comm_override, profile);
 #else
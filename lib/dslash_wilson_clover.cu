@@ -100,6 +100,10 @@ namespace quda
   void ApplyWilsonClover(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, const CloverField &A,
       double a, const ColorSpinorField &x, int parity, bool dagger, const int *comm_override, TimeProfile &profile)
   {
+    if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
+      ApplyWilsonCloverCPU(out, in, U, A, a, x, parity, dagger, comm_override);
+      return;
+    }
 #ifdef GPU_CLOVER_DIRAC
     instantiate<WilsonCloverApply>(out, in, U, A, a, x, parity, dagger, comm_override, profile);
 #else
@@ -129,6 +129,10 @@ namespace quda
       const CloverField &A, double a, const ColorSpinorField &x, int parity, bool dagger, const int *comm_override,
       TimeProfile &profile)
   {
+    if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
+      ApplyWilsonCloverPreconditionedCPU(out, in, U, A, a, x, parity, dagger, comm_override);
+      return;
+    }
 #ifdef GPU_CLOVER_DIRAC
     instantiate<WilsonCloverPreconditionedApply>(out, in, U, A, a, x, parity, dagger, comm_override, profile);
 #else
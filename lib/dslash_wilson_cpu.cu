@@ -0,0 +1,384 @@
+#include <color_spinor_field.h>
+#include <gauge_field.h>
+#include <clover_field.h>
+#include <dslash_quda.h>
+#include <color_spinor_field_order.h>
+#include <gauge_field_order.h>
+#include <clover_field_order.h>
+#include <color_spinor.h>
+#include <index_helper.cuh>
+
+/**
+   Host implementation of the Wilson and Wilson-clover operators, used
+   when a Dirac operator is applied to CPU fields.  Spinors are in
+   QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, links in QUDA_QDP_GAUGE_ORDER
+   without reconstruction and the clover term in
+   QUDA_PACKED_CLOVER_ORDER, and the arithmetic is the same per-site
+   algebra as the device kernels (UKQCD basis spin projection, chiral
+   basis clover application), so host and device results agree to
+   rounding.
+*/
+
+namespace quda
+{
+
+  /**
+     @brief The spin projectors and the clover rotation to the chiral
+     basis assume the UKQCD basis, so the host operators require it
+     rather than rotating in and out on every application.
+  */
+  inline void checkGammaBasisCPU(const ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &x)
+  {
+    if (out.GammaBasis() != QUDA_UKQCD_GAMMA_BASIS || in.GammaBasis() != QUDA_UKQCD_GAMMA_BASIS
+        || x.GammaBasis() != QUDA_UKQCD_GAMMA_BASIS)
+      errorQuda("Host operators require the UKQCD gamma basis (out=%d in=%d x=%d)", out.GammaBasis(),
+                in.GammaBasis(), x.GammaBasis());
+  }
+
+  template <typename Float, int nColor_> struct WilsonCPUArg {
+    static constexpr int nColor = nColor_;
+    static constexpr int nSpin = 4;
+    using real = typename mapper<Float>::type;
+    using F = colorspinor::SpaceSpinorColorOrder<Float, nSpin, nColor>;
+    using G = gauge::QDPOrder<Float, 2 * nColor * nColor>;
+
+    F out;          /** output vector field */
+    const F in;     /** input vector field */
+    const F x;      /** input vector when doing xpay */
+    const G U;      /** the gauge field */
+    const real a;   /** xpay scale factor */
+    const int parity;  /** destination parity (single parity fields only) */
+    const int nParity; /** number of parities we are working on */
+    int X[4];       /** full local lattice dimensions */
+    int commDim[4]; /** whether a given dimension is partitioned and communicating */
+
+    WilsonCPUArg(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
+                 const ColorSpinorField &x, int parity, const int *comm_override) :
+      out(out),
+      in(in, 1, nullptr, nullptr, (Float **)in.Ghost()),
+      x(x),
+      U(U),
+      a(a),
+      parity(parity),
+      nParity(in.SiteSubset())
+    {
+      if (in.V() == out.V()) errorQuda("Aliasing pointers");
+      checkPrecision(out, in, x, U);
+      checkLocation(out, in, x, U);
+      if (in.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || out.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER
+          || x.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || U.Order() != QUDA_QDP_GAUGE_ORDER)
+        errorQuda("Unsupported field order colorspinor=%d gauge=%d combination", in.FieldOrder(), U.Order());
+      if (U.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Unsupported reconstruct %d", U.Reconstruct());
+      if (in.Ndim() != 4) errorQuda("Unsupported number of dimensions %d", in.Ndim());
+      checkGammaBasisCPU(out, in, x);
+
+      for (int d = 0; d < 4; d++) {
+        X[d] = U.X()[d];
+        commDim[d] = comm_dim_partitioned(d) && (comm_override ? comm_override[d] : 1);
+        if (commDim[d] && U.GhostExchange() != QUDA_GHOST_EXCHANGE_PAD)
+          errorQuda("Host gauge field requires a ghost zone in partitioned dimension %d", d);
+      }
+    }
+  };
+
+  template <typename Float, int nColor> struct WilsonCloverCPUArg : WilsonCPUArg<Float, nColor> {
+    using C = clover::QDPOrder<Float, 8 * nColor * nColor>;
+    const C A; /** the clover field (or its inverse) */
+
+    WilsonCloverCPUArg(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, const CloverField &A,
+                       bool inverse, double a, const ColorSpinorField &x, int parity, const int *comm_override) :
+      WilsonCPUArg<Float, nColor>(out, in, U, a, x, parity, comm_override),
+      A(A, inverse)
+    {
+      checkPrecision(U, A);
+      checkLocation(U, A);
+      if (inverse && !A.V(true)) errorQuda("Clover inverse has not been allocated");
+      if (A.Rho() != 0.0) errorQuda("Host clover application does not support rho = %e", A.Rho());
+    }
+  };
+
+  /**
+     @brief Apply the off-diagonal part of the Wilson operator at a
+     single site.  Faces in partitioned dimensions are read from the
+     (unprojected) host ghost zones, all other neighbours wrap around
+     the local volume.
+
+     @param[in] arg Parameter struct
+     @param[in] coord Full lattice coordinates of the site
+     @param[in] x_cb Checkerboard index of the site
+     @param[in] parity Site parity
+     @return The result of the hopping term at this site
+  */
+  template <bool dagger, typename Arg>
+  inline ColorSpinor<typename Arg::real, Arg::nColor, 4> applyWilsonCPU(const Arg &arg, const int coord[4], int x_cb,
+                                                                        int parity)
+  {
+    using real = typename Arg::real;
+    using Vector = ColorSpinor<real, Arg::nColor, 4>;
+    using Link = Matrix<complex<real>, Arg::nColor>;
+    const int their_spinor_parity = arg.nParity == 2 ? 1 - parity : 0;
+
+    Vector out;
+    for (int d = 0; d < 4; d++) {
+      { // forward gather
+        constexpr int proj_dir = dagger ? +1 : -1;
+        const Link U = arg.U(d, x_cb, parity);
+        Vector in;
+        if (arg.commDim[d] && coord[d] == arg.X[d] - 1) {
+          arg.in.loadGhost(in.data, ghostFaceIndex<1>(coord, arg.X, d, 1), d, 1, their_spinor_parity);
+        } else {
+          in = arg.in(linkIndexP1(coord, arg.X, d), their_spinor_parity);
+        }
+        out += (U * in.project(d, proj_dir)).reconstruct(d, proj_dir);
+      }
+
+      { // backward gather
+        constexpr int proj_dir = dagger ? -1 : +1;
+        Link U;
+        Vector in;
+        if (arg.commDim[d] && coord[d] == 0) {
+          const int ghost_idx = ghostFaceIndex<0>(coord, arg.X, d, 1);
+          U = arg.U.Ghost(d, ghost_idx, 1 - parity);
+          arg.in.loadGhost(in.data, ghost_idx, d, 0, their_spinor_parity);
+        } else {
+          const int back_idx = linkIndexM1(coord, arg.X, d);
+          U = arg.U(d, back_idx, 1 - parity);
+          in = arg.in(back_idx, their_spinor_parity);
+        }
+        out += (conj(U) * in.project(d, proj_dir)).reconstruct(d, proj_dir);
+      }
+    }
+    return out;
+  }
+
+  /**
+     @brief Apply the clover term (or its inverse) at a single site,
+     using the same chiral-basis convention as the device kernels.
+  */
+  template <typename Arg>
+  inline ColorSpinor<typename Arg::real, Arg::nColor, 4>
+  applyCloverCPU(const Arg &arg, ColorSpinor<typename Arg::real, Arg::nColor, 4> in, int x_cb, int parity)
+  {
+    using real = typename Arg::real;
+    constexpr int N = Arg::nColor * Arg::nSpin / 2;
+    real A[2 * N * N];
+    arg.A.load(A, x_cb, parity);
+
+    in.toRel(); // switch to chiral basis
+    ColorSpinor<real, Arg::nColor, 4> out;
+    for (int chirality = 0; chirality < 2; chirality++) {
+      HMatrix<real, N> A_chi(A + chirality * N * N);
+      ColorSpinor<real, Arg::nColor, 2> chi = in.chiral_project(chirality);
+      out += (A_chi * chi).chiral_reconstruct(chirality);
+    }
+    out.toNonRel(); // switch back to non-chiral basis
+    return out;
+  }
+
+  /**
+     @brief Apply f to every destination site.  Each iteration of the
+     threaded loop sweeps one (x, y) plane, so a thread walks its
+     planes in z order and the neighbouring planes read by the stencil
+     are still in cache from the previous iteration.
+  */
+  template <typename Arg, typename Site> void forEachSiteCPU(const Arg &arg, Site site)
+  {
+    const int X0h = arg.X[0] / 2;
+    for (int p = 0; p < arg.nParity; p++) {
+      const int parity = arg.nParity == 2 ? p : arg.parity;
+#pragma omp parallel for collapse(2) schedule(static)
+      for (int t = 0; t < arg.X[3]; t++) {
+        for (int z = 0; z < arg.X[2]; z++) {
+          for (int y = 0; y < arg.X[1]; y++) {
+            const int x_odd = (y + z + t + parity) & 1;
+            int x_cb = ((t * arg.X[2] + z) * arg.X[1] + y) * X0h;
+            for (int xh = 0; xh < X0h; xh++, x_cb++) {
+              const int coord[4] = {2 * xh + x_odd, y, z, t};
+              site(coord, x_cb, parity);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+     @brief Exchange the ghost zone of the input field, if any
+     dimension we are applying the stencil in is partitioned.
+  */
+  template <typename Arg> void exchangeGhostCPU(const Arg &arg, const ColorSpinorField &in, int parity, bool dagger)
+  {
+    bool comms = false;
+    for (int d = 0; d < 4; d++) comms = comms || arg.commDim[d];
+    if (!comms) return;
+    in.exchangeGhost((QudaParity)(in.SiteSubset() == QUDA_PARITY_SITE_SUBSET ? (1 - parity) : 0), 1, dagger);
+  }
+
+  template <typename Float, int nColor, bool dagger, bool xpay>
+  void wilsonCPU(WilsonCPUArg<Float, nColor> &arg)
+  {
+    forEachSiteCPU(arg, [&](const int coord[4], int x_cb, int parity) {
+      const int my_spinor_parity = arg.nParity == 2 ? parity : 0;
+      auto out = applyWilsonCPU<dagger>(arg, coord, x_cb, parity);
+      if (xpay) {
+        decltype(out) x = arg.x(x_cb, my_spinor_parity);
+        out = x + arg.a * out;
+      }
+      arg.out(x_cb, my_spinor_parity) = out;
+    });
+  }
+
+  template <typename Float, int nColor, bool dagger, bool preconditioned, bool xpay>
+  void wilsonCloverCPU(WilsonCloverCPUArg<Float, nColor> &arg)
+  {
+    forEachSiteCPU(arg, [&](const int coord[4], int x_cb, int parity) {
+      const int my_spinor_parity = arg.nParity == 2 ? parity : 0;
+      auto out = applyWilsonCPU<dagger>(arg, coord, x_cb, parity);
+      if (preconditioned) { // A^{-1} D in, optionally + x
+        out = applyCloverCPU(arg, out, x_cb, parity);
+        if (xpay) {
+          decltype(out) x = arg.x(x_cb, my_spinor_parity);
+          out = x + arg.a * out;
+        }
+      } else { // A x + a D in
+        decltype(out) x = arg.x(x_cb, my_spinor_parity);
+        out = applyCloverCPU(arg, x, x_cb, parity) + arg.a * out;
+      }
+      arg.out(x_cb, my_spinor_parity) = out;
+    });
+  }
+
+  template <typename Float, int nColor>
+  void ApplyWilsonCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
+                      const ColorSpinorField &x, int parity, bool dagger, const int *comm_override)
+  {
+    WilsonCPUArg<Float, nColor> arg(out, in, U, a, x, parity, comm_override);
+    exchangeGhostCPU(arg, in, parity, dagger);
+    if (dagger) {
+      a != 0.0 ? wilsonCPU<Float, nColor, true, true>(arg) : wilsonCPU<Float, nColor, true, false>(arg);
+    } else {
+      a != 0.0 ? wilsonCPU<Float, nColor, false, true>(arg) : wilsonCPU<Float, nColor, false, false>(arg);
+    }
+  }
+
+  template <typename Float, int nColor, bool preconditioned>
+  void ApplyWilsonCloverCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U,
+                            const CloverField &A, double a, const ColorSpinorField &x, int parity, bool dagger,
+                            const int *comm_override)
+  {
+    WilsonCloverCPUArg<Float, nColor> arg(out, in, U, A, preconditioned, a, x, parity, comm_override);
+    exchangeGhostCPU(arg, in, parity, dagger);
+    // the non-preconditioned operator only exists in xpay form
+    const bool xpay = !preconditioned || a != 0.0;
+    if (dagger) {
+      xpay ? wilsonCloverCPU<Float, nColor, true, preconditioned, true>(arg) :
+             wilsonCloverCPU<Float, nColor, true, preconditioned, false>(arg);
+    } else {
+      xpay ? wilsonCloverCPU<Float, nColor, false, preconditioned, true>(arg) :
+             wilsonCloverCPU<Float, nColor, false, preconditioned, false>(arg);
+    }
+  }
+
+  template <typename Float, int nColor>
+  void ApplyCloverCPU(ColorSpinorField &out, const ColorSpinorField &in, const CloverField &A, bool inverse,
+                      int parity)
+  {
+    if (out.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || in.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+      errorQuda("Unsupported field order %d %d", out.FieldOrder(), in.FieldOrder());
+    if (inverse && !A.V(true)) errorQuda("Clover inverse has not been allocated");
+    if (A.Rho() != 0.0) errorQuda("Host clover application does not support rho = %e", A.Rho());
+    checkGammaBasisCPU(out, in, in);
+    checkPrecision(out, in, A);
+    checkLocation(out, in, A);
+
+    using real = typename mapper<Float>::type;
+    using F = colorspinor::SpaceSpinorColorOrder<Float, 4, nColor>;
+    using C = clover::QDPOrder<Float, 8 * nColor * nColor>;
+    constexpr int N = 2 * nColor;
+    F out_(out);
+    const F in_(in);
+    const C A_(A, inverse);
+    const int nParity = in.SiteSubset();
+
+    for (int p = 0; p < nParity; p++) {
+      const int clover_parity = nParity == 2 ? p : parity;
+#pragma omp parallel for schedule(static)
+      for (int x_cb = 0; x_cb < in.VolumeCB(); x_cb++) {
+        real a[2 * N * N];
+        A_.load(a, x_cb, clover_parity);
+        ColorSpinor<real, nColor, 4> v = in_(x_cb, p);
+        v.toRel();
+        ColorSpinor<real, nColor, 4> w;
+        for (int chirality = 0; chirality < 2; chirality++) {
+          HMatrix<real, N> A_chi(a + chirality * N * N);
+          w += (A_chi * v.chiral_project(chirality)).chiral_reconstruct(chirality);
+        }
+        w.toNonRel();
+        out_(x_cb, p) = w;
+      }
+    }
+  }
+
+  template <template <typename, int> class Apply, typename... Args>
+  void instantiateCPU(const ColorSpinorField &in, Args &&... args)
+  {
+    if (in.Ncolor() != 3) errorQuda("Unsupported number of colors %d", in.Ncolor());
+    if (in.Nspin() != 4) errorQuda("Unsupported number of spins %d", in.Nspin());
+    if (in.Precision() == QUDA_DOUBLE_PRECISION) {
+      Apply<double, 3>::apply(args...);
+    } else if (in.Precision() == QUDA_SINGLE_PRECISION) {
+      Apply<float, 3>::apply(args...);
+    } else {
+      errorQuda("Unsupported precision %d for host fields", in.Precision());
+    }
+  }
+
+  template <typename Float, int nColor> struct WilsonCPU {
+    template <typename... Args> static void apply(Args &&... args) { ApplyWilsonCPU<Float, nColor>(args...); }
+  };
+
+  template <typename Float, int nColor> struct WilsonCloverCPU {
+    template <typename... Args> static void apply(Args &&... args)
+    {
+      ApplyWilsonCloverCPU<Float, nColor, false>(args...);
+    }
+  };
+
+  template <typename Float, int nColor> struct WilsonCloverPreconditionedCPU {
+    template <typename... Args> static void apply(Args &&... args)
+    {
+      ApplyWilsonCloverCPU<Float, nColor, true>(args...);
+    }
+  };
+
+  template <typename Float, int nColor> struct CloverCPU {
+    template <typename... Args> static void apply(Args &&... args) { ApplyCloverCPU<Float, nColor>(args...); }
+  };
+
+  void ApplyWilsonCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U, double a,
+                      const ColorSpinorField &x, int parity, bool dagger, const int *comm_override)
+  {
+    instantiateCPU<WilsonCPU>(in, out, in, U, a, x, parity, dagger, comm_override);
+  }
+
+  void ApplyWilsonCloverCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U,
+                            const CloverField &A, double a, const ColorSpinorField &x, int parity, bool dagger,
+                            const int *comm_override)
+  {
+    instantiateCPU<WilsonCloverCPU>(in, out, in, U, A, a, x, parity, dagger, comm_override);
+  }
+
+  void ApplyWilsonCloverPreconditionedCPU(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &U,
+                                          const CloverField &A, double a, const ColorSpinorField &x, int parity,
+                                          bool dagger, const int *comm_override)
+  {
+    instantiateCPU<WilsonCloverPreconditionedCPU>(in, out, in, U, A, a, x, parity, dagger, comm_override);
+  }
+
+  void ApplyCloverCPU(ColorSpinorField &out, const ColorSpinorField &in, const CloverField &A, bool inverse,
+                      int parity)
+  {
+    instantiateCPU<CloverCPU>(in, out, in, A, inverse, parity);
+  }
+
+} // namespace quda
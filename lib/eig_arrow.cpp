@@ -0,0 +1,358 @@
+#include <math.h>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#include <quda_internal.h>
+#include <eigensolve_quda.h>
+#include <eigen_helper.h>
+
+/**
+   Divide and conquer eigensolver for the symmetric arrow matrices
+   that arise in the thick restarted Lanczos method: a diagonal block
+   coupled to row arrow_pos by an arrow, followed by a tridiagonal
+   tail.  Removing the coupling row of such a matrix leaves a
+   diagonal block and a tridiagonal block; once these have been
+   diagonalised the matrix is a pure arrowhead matrix, whose
+   eigenpairs follow from the secular equation in O(n^2) work.  The
+   tridiagonal tail is treated recursively in the same way (removing
+   its middle row), cf. Gu and Eisenstat, SIAM J. Matrix Anal. Appl.
+   16 (1995) 172.  Transforming the eigenvectors back through the
+   sub-problems is a matrix product, so the total cost remains
+   O(n^3), but with a far smaller constant than a dense solve.
+*/
+
+namespace quda
+{
+
+  namespace
+  {
+
+    // below this size we simply use a dense eigensolver
+    constexpr int arrow_dense_cutoff = 16;
+
+    constexpr double arrow_eps = std::numeric_limits<double>::epsilon();
+
+    /**
+       A root of the secular equation, stored relative to the pole
+       it is closest to, such that differences d_i - lambda can be
+       formed as (d_i - d_origin) - tau without cancellation.
+    */
+    struct SecularRoot {
+      int origin;
+      double tau;
+    };
+
+    /**
+       @brief Evaluate the secular function g(tau) = d_o + tau - alpha
+       + sum_i z_i^2 / (delta_i - tau), where delta_i = d_i - d_o
+       @param[out] g The secular function
+       @param[out] g_rest The secular function excluding the origin pole term
+       @param[out] dg_rest The derivative of g_rest
+       @param[out] g_abs The sum of the absolute value of the terms in g
+    */
+    void secular(const std::vector<double> &delta, const std::vector<double> &z2, int o, double shift, double tau,
+                 double &g, double &g_rest, double &dg_rest, double &g_abs)
+    {
+      g_rest = shift + tau;
+      dg_rest = 1.0;
+      g_abs = fabs(g_rest);
+      double g_origin = 0.0;
+      for (int i = 0; i < (int)delta.size(); i++) {
+        double inv = 1.0 / (delta[i] - tau);
+        double term = z2[i] * inv;
+        g_abs += fabs(term);
+        if (i == o) {
+          g_origin = term;
+        } else {
+          g_rest += term;
+          dg_rest += term * inv;
+        }
+      }
+      g = g_rest + g_origin;
+    }
+
+    /**
+       @brief Find the root of the secular equation in the bracket
+       (lo, hi), given relative to pole o.  We model the smooth part
+       of g linearly and treat the origin pole exactly, giving a
+       quadratic for the next iterate, and fall back to bisection
+       whenever this leaves the bracket.
+    */
+    double secularRoot(const std::vector<double> &d, const std::vector<double> &z2, double alpha, int o, double lo,
+                       double hi)
+    {
+      const int K = d.size();
+      std::vector<double> delta(K);
+      for (int i = 0; i < K; i++) delta[i] = d[i] - d[o];
+      const double shift = d[o] - alpha;
+      const bool right = hi > 0.0; // is the root to the right of the origin pole
+
+      double tau = 0.5 * (lo + hi);
+      for (int iter = 0; iter < 256; iter++) {
+        double g, g_rest, dg_rest, g_abs;
+        secular(delta, z2, o, shift, tau, g, g_rest, dg_rest, g_abs);
+
+        if (fabs(g) <= 8.0 * arrow_eps * K * g_abs) break;
+        if (g > 0.0)
+          hi = tau;
+        else
+          lo = tau;
+        if (hi - lo <= 2.0 * arrow_eps * std::max(fabs(lo), fabs(hi))) break;
+
+        // solve g_rest + dg_rest (t - tau) - z_o^2 / t = 0
+        double b = g_rest - dg_rest * tau;
+        double disc = sqrt(b * b + 4.0 * dg_rest * z2[o]);
+        double t;
+        if (right)
+          t = (b <= 0.0) ? (disc - b) / (2.0 * dg_rest) : 2.0 * z2[o] / (b + disc);
+        else
+          t = (b >= 0.0) ? -(b + disc) / (2.0 * dg_rest) : -2.0 * z2[o] / (disc - b);
+
+        tau = (t > lo && t < hi && std::isfinite(t)) ? t : 0.5 * (lo + hi);
+      }
+
+      return tau;
+    }
+
+    /**
+       @brief Eigendecomposition of the arrowhead matrix [[diag(d), z],
+       [z^T, alpha]].  Eigenvalues are returned in ascending order,
+       and the eigenvectors are the columns of U, with the arrow tip
+       as the last row.
+    */
+    void arrowheadEigensolve(const VectorXd &d_in, const VectorXd &z_in, double alpha, VectorXd &lambda, MatrixXd &U)
+    {
+      const int nd = d_in.size();
+      const int n = nd + 1;
+
+      // sort the poles
+      std::vector<int> perm(nd);
+      std::iota(perm.begin(), perm.end(), 0);
+      std::sort(perm.begin(), perm.end(), [&](int a, int b) { return d_in[a] < d_in[b]; });
+      std::vector<double> d(nd), z(nd);
+      for (int i = 0; i < nd; i++) {
+        d[i] = d_in[perm[i]];
+        z[i] = z_in[perm[i]];
+      }
+
+      double d_max = fabs(alpha), z_max = 0.0, z_norm = 0.0;
+      for (int i = 0; i < nd; i++) {
+        d_max = std::max(d_max, fabs(d[i]));
+        z_max = std::max(z_max, fabs(z[i]));
+        z_norm += z[i] * z[i];
+      }
+      z_norm = sqrt(z_norm);
+      const double tol = 8.0 * arrow_eps * std::max(d_max, z_max);
+
+      // deflation: small z components, or (nearly) equal poles, where a
+      // Givens rotation zeros one of the pair of z components
+      struct Givens {
+        int i, j;
+        double c, s;
+      };
+      std::vector<Givens> rotations;
+      std::vector<bool> deflated(nd, false);
+      int last = -1;
+      for (int i = 0; i < nd; i++) {
+        if (fabs(z[i]) <= tol) {
+          deflated[i] = true;
+          continue;
+        }
+        if (last >= 0 && d[i] - d[last] <= tol) {
+          double r = hypot(z[last], z[i]);
+          double c = z[i] / r, s = z[last] / r;
+          rotations.push_back({last, i, c, s});
+          z[i] = r;
+          z[last] = 0.0;
+          deflated[last] = true;
+        }
+        last = i;
+      }
+
+      std::vector<int> keep;
+      for (int i = 0; i < nd; i++)
+        if (!deflated[i]) keep.push_back(i);
+      const int K = keep.size();
+
+      std::vector<double> dk(K), z2(K);
+      for (int k = 0; k < K; k++) {
+        dk[k] = d[keep[k]];
+        z2[k] = z[keep[k]] * z[keep[k]];
+      }
+
+      // roots of the secular equation, interlacing the poles
+      std::vector<SecularRoot> root(K + 1);
+      if (K > 0) {
+        {
+          double lo = std::min(0.0, alpha - dk[0]) - 1.01 * z_norm;
+          root[0] = {0, secularRoot(dk, z2, alpha, 0, lo, 0.0)};
+        }
+        for (int j = 1; j < K; j++) {
+          // pick the closer pole as origin by evaluating g at the midpoint
+          double gap = dk[j] - dk[j - 1];
+          std::vector<double> delta(K);
+          for (int i = 0; i < K; i++) delta[i] = dk[i] - dk[j - 1];
+          double g, g_rest, dg_rest, g_abs;
+          secular(delta, z2, j - 1, dk[j - 1] - alpha, 0.5 * gap, g, g_rest, dg_rest, g_abs);
+          if (g >= 0.0)
+            root[j] = {j - 1, secularRoot(dk, z2, alpha, j - 1, 0.0, 0.5 * gap)};
+          else
+            root[j] = {j, secularRoot(dk, z2, alpha, j, -0.5 * gap, 0.0)};
+        }
+        {
+          double hi = std::max(0.0, alpha - dk[K - 1]) + 1.01 * z_norm;
+          root[K] = {K - 1, secularRoot(dk, z2, alpha, K - 1, 0.0, hi)};
+        }
+      }
+
+      // d_k - lambda_j formed relative to the origin pole of lambda_j
+      auto diff = [&](int k, int j) { return (dk[k] - dk[root[j].origin]) - root[j].tau; };
+
+      // recompute z from the computed eigenvalues (Gu and Eisenstat)
+      // so that the eigenvectors are numerically orthogonal
+      std::vector<double> zhat(K);
+      for (int k = 0; k < K; k++) {
+        double prod = -diff(k, K) * diff(k, k);
+        for (int l = 0; l < K; l++) {
+          if (l == k) continue;
+          prod *= diff(k, l) / (dk[k] - dk[l]);
+        }
+        zhat[k] = copysign(sqrt(fabs(prod)), z[keep[k]]);
+      }
+
+      // assemble the eigenpairs in the rotated, sorted basis
+      std::vector<double> eval(n);
+      MatrixXd W = MatrixXd::Zero(n, n);
+      int col = 0;
+      for (int j = 0; j <= K; j++, col++) {
+        double norm = 1.0;
+        for (int k = 0; k < K; k++) {
+          double v = zhat[k] / diff(k, j);
+          W(keep[k], col) = v;
+          norm += v * v;
+        }
+        W(nd, col) = -1.0;
+        W.col(col) /= sqrt(norm);
+        eval[col] = K > 0 ? dk[root[j].origin] + root[j].tau : alpha;
+      }
+      for (int i = 0; i < nd; i++) {
+        if (!deflated[i]) continue;
+        W(i, col) = 1.0;
+        eval[col++] = d[i];
+      }
+
+      // undo the deflation rotations
+      for (auto it = rotations.rbegin(); it != rotations.rend(); it++) {
+        for (int c = 0; c < n; c++) {
+          double wi = W(it->i, c), wj = W(it->j, c);
+          W(it->i, c) = it->c * wi + it->s * wj;
+          W(it->j, c) = -it->s * wi + it->c * wj;
+        }
+      }
+
+      // undo the sort of the poles and order the eigenvalues
+      std::vector<int> order(n);
+      std::iota(order.begin(), order.end(), 0);
+      std::sort(order.begin(), order.end(), [&](int a, int b) { return eval[a] < eval[b]; });
+
+      lambda.resize(n);
+      U.resize(n, n);
+      for (int c = 0; c < n; c++) {
+        lambda[c] = eval[order[c]];
+        for (int i = 0; i < nd; i++) U(perm[i], c) = W(i, order[c]);
+        U(nd, c) = W(nd, order[c]);
+      }
+    }
+
+    /**
+       @brief Recursive eigendecomposition of the arrow matrix with
+       diagonal a, arrow b[0..p-1] into row p, and sub-diagonal
+       b[p..n-2].  With p = 0 this is a tridiagonal matrix.
+    */
+    void arrowEigensolve(int p, const VectorXd &a, const VectorXd &b, VectorXd &lambda, MatrixXd &V)
+    {
+      const int n = a.size();
+
+      if (n <= arrow_dense_cutoff) {
+        MatrixXd A = MatrixXd::Zero(n, n);
+        for (int i = 0; i < n; i++) A(i, i) = a[i];
+        for (int i = 0; i < p; i++) A(i, p) = A(p, i) = b[i];
+        for (int i = p; i < n - 1; i++) A(i, i + 1) = A(i + 1, i) = b[i];
+        SelfAdjointEigenSolver<MatrixXd> eigensolver(A);
+        lambda = eigensolver.eigenvalues();
+        V = eigensolver.eigenvectors();
+        return;
+      }
+
+      // the row we remove: the arrow row, else the middle of the tridiagonal
+      const int k = p > 0 ? p : n / 2;
+      const int nl = k;
+      const int nr = n - k - 1;
+
+      VectorXd lambda_l, lambda_r;
+      MatrixXd Q_l, Q_r;
+      VectorXd z(nl + nr);
+
+      if (p > 0) {
+        // diagonal block: trivially diagonal
+        lambda_l = a.head(nl);
+        z.head(nl) = b.head(nl);
+      } else if (nl > 0) {
+        arrowEigensolve(0, a.head(nl), b.head(std::max(nl - 1, 0)), lambda_l, Q_l);
+        z.head(nl) = b[k - 1] * Q_l.row(nl - 1).transpose();
+      }
+
+      if (nr > 0) {
+        arrowEigensolve(0, a.tail(nr), b.tail(std::max(nr - 1, 0)), lambda_r, Q_r);
+        z.tail(nr) = b[k] * Q_r.row(0).transpose();
+      }
+
+      VectorXd d(nl + nr);
+      d << lambda_l, lambda_r;
+
+      MatrixXd U;
+      arrowheadEigensolve(d, z, a[k], lambda, U);
+
+      // transform back to the original basis
+      V.resize(n, n);
+      if (p > 0)
+        V.topRows(nl) = U.topRows(nl);
+      else if (nl > 0)
+        V.topRows(nl).noalias() = Q_l * U.topRows(nl);
+      V.row(k) = U.row(n - 1);
+      if (nr > 0) V.bottomRows(nr).noalias() = Q_r * U.middleRows(nl, nr);
+    }
+
+  } // namespace
+
+  void arrowEigensolve(int arrow_pos, const std::vector<double> &diag, const std::vector<double> &off,
+                       std::vector<double> &evals, std::vector<double> &evecs)
+  {
+    const int n = diag.size();
+    if ((int)off.size() < n - 1) errorQuda("Off-diagonal length %lu insufficient for dimension %d", off.size(), n);
+    if (arrow_pos < 0 || arrow_pos >= n) errorQuda("Invalid arrow position %d for dimension %d", arrow_pos, n);
+
+    VectorXd a = Map<const VectorXd>(diag.data(), n);
+    VectorXd b = Map<const VectorXd>(off.data(), std::max(n - 1, 0));
+
+    // scale to avoid overflow and underflow in the secular equation
+    double scale = std::max(a.cwiseAbs().maxCoeff(), n > 1 ? b.cwiseAbs().maxCoeff() : 0.0);
+    if (scale == 0.0) scale = 1.0;
+    a /= scale;
+    b /= scale;
+
+    VectorXd lambda;
+    MatrixXd V;
+    arrowEigensolve(arrow_pos, a, b, lambda, V);
+
+    evals.resize(n);
+    evecs.resize(n * n);
+    for (int i = 0; i < n; i++) {
+      evals[i] = scale * lambda[i];
+      for (int j = 0; j < n; j++) evecs[n * i + j] = V(j, i);
+    }
+  }
+
+} // namespace quda
@@ -199,113 +199,138 @@ namespace quda
     // This isn't really Eigen, but it's morally equivalent
     profile.TPSTART(QUDA_PROFILE_HOST_COMPUTE);
 
-    // Reset Q to the identity, copy upper Hessenberg
-    MatrixXcd UHcopy = MatrixXcd::Zero(n_kr, n_kr);
+    // Reset Q to the identity
     for (int i = 0; i < n_kr; i++) {
-      for (int j = 0; j < n_kr; j++) {
-        if (i == j)
-          Qmat[i][j] = 1.0;
-        else
-          Qmat[i][j] = 0.0;
-        UHcopy(i, j) = upperHess[i][j];
-      }
+      for (int j = 0; j < n_kr; j++) Qmat[i][j] = (i == j) ? 1.0 : 0.0;
     }
 
-    for (int shift = 0; shift < num_shifts; shift++) {
-
-      // Shift the eigenvalue
-      for (int i = 0; i < n_kr; i++) upperHess[i][i] -= evals[shift];
-
-      qrIteration(Qmat, upperHess);
-
-      for (int i = 0; i < n_kr; i++) upperHess[i][i] += evals[shift];
-    }
+    // Apply the shifts in place, in chains of qr_chain_shifts
+    for (int shift = 0; shift < num_shifts; shift += qr_chain_shifts)
+      qrChase(Qmat, upperHess, n_kr, evals.data() + shift, std::min(qr_chain_shifts, num_shifts - shift),
+              eig_param->qr_tol);
 
     profile.TPSTOP(QUDA_PROFILE_HOST_COMPUTE);
   }
 
-  void IRAM::qrIteration(Complex **Q, Complex **R)
+  namespace
   {
-    Complex T11, T12, T21, T22, U1, U2;
-    double dV;
-
-    double tol = eig_param->qr_tol;
+    /**
+       A Givens rotation G = [[c, s], [-conj(s), c]] acting on
+       rows/columns (k, k+1)
+    */
+    struct Givens {
+      int k;
+      double c;
+      Complex s;
+    };
+
+    /**
+       @brief Compute the rotation G such that G [a; b] = [r; 0]
+    */
+    Givens makeGivens(int k, const Complex &a, const Complex &b)
+    {
+      double abs_a = abs(a), abs_b = abs(b);
+      if (abs_b == 0.0) return {k, 1.0, 0.0};
+      if (abs_a == 0.0) return {k, 0.0, conj(b) / abs_b};
+      double nrm = sqrt(abs_a * abs_a + abs_b * abs_b);
+      return {k, abs_a / nrm, (a / abs_a) * conj(b) / nrm};
+    }
 
-    // Allocate the rotation matrices.
-    std::vector<Complex> R11(n_kr - 1, 0.0);
-    std::vector<Complex> R12(n_kr - 1, 0.0);
-    std::vector<Complex> R21(n_kr - 1, 0.0);
-    std::vector<Complex> R22(n_kr - 1, 0.0);
+    // x <- G x on elements (x_k, x_k+1) of a column
+    inline void rotateRows(const Givens &g, Complex &x0, Complex &x1)
+    {
+      Complex t = x0;
+      x0 = g.c * t + g.s * x1;
+      x1 = -conj(g.s) * t + g.c * x1;
+    }
 
-    for (int i = 0; i < n_kr - 1; i++) {
+    // x <- x G^dag on elements (x_k, x_k+1) of a row
+    inline void rotateCols(const Givens &g, Complex &x0, Complex &x1)
+    {
+      Complex t = x0;
+      x0 = g.c * t + conj(g.s) * x1;
+      x1 = -g.s * t + g.c * x1;
+    }
+  } // namespace
 
-      // If the sub-diagonal element is numerically
-      // small enough, floor it to 0;
-      if (abs(R[i + 1][i]) < tol) {
-        R[i + 1][i] = 0.0;
+  void qrChase(Complex **Q, Complex **H, int n, const Complex *shifts, int num_shifts, double tol, int chase_steps)
+  {
+    // If a sub-diagonal element is numerically small enough, floor
+    // it to 0, splitting H into unreduced blocks
+    for (int i = 0; i < n - 1; i++)
+      if (abs(H[i + 1][i]) < tol) H[i + 1][i] = 0.0;
+
+    std::vector<Givens> rot;
+    rot.reserve(chase_steps * num_shifts);
+
+    for (int lo = 0; lo < n - 1;) {
+      int hi = lo;
+      while (hi < n - 1 && H[hi + 1][hi] != 0.0) hi++;
+      if (hi == lo) {
+        lo++;
         continue;
       }
 
-      U1 = R[i][i];
-      dV = sqrt(norm(R[i][i]) + norm(R[i + 1][i]));
-      dV = (U1.real() > 0) ? dV : -dV;
-      U1 += dV;
-      U2 = R[i + 1][i];
-
-      T11 = conj(U1) / dV;
-      R11[i] = conj(T11);
-
-      T12 = conj(U2) / dV;
-      R12[i] = conj(T12);
-
-      T21 = conj(T12) * conj(U1) / U1;
-      R21[i] = conj(T21);
-
-      T22 = T12 * U2 / U1;
-      R22[i] = conj(T22);
-
-      // Do the H_kk and set the H_k+1k to zero
-      R[i][i] -= (T11 * R[i][i] + T12 * R[i + 1][i]);
-      R[i + 1][i] = 0;
-
-      // Continue for the other columns
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static, 32)
-#endif
-      for (int j = i + 1; j < n_kr; j++) {
-        Complex temp = R[i][j];
-        R[i][j] -= (T11 * temp + T12 * R[i + 1][j]);
-        R[i + 1][j] -= (T21 * temp + T22 * R[i + 1][j]);
-      }
-    }
+      // Chase a chain of bulges, one per shift, through H(lo:hi, lo:hi).
+      // At step t, the bulge of shift j is at position k = lo + t - 2j:
+      // this spacing makes the result identical to applying the shifts
+      // one after another.
+      const int n_steps = (hi - lo) + 2 * (num_shifts - 1);
+      for (int t0 = 0; t0 < n_steps; t0 += chase_steps) {
+        const int t1 = std::min(t0 + chase_steps, n_steps);
+
+        // The window of H touched near the diagonal during these steps:
+        // we update it immediately, and defer the remainder of H and Q
+        const int kmin = std::max(lo, lo + t0 - 2 * (num_shifts - 1));
+        const int kmax = std::min(hi - 1, lo + t1 - 1);
+        const int wlo = std::max(lo, kmin - 1);
+        const int whi = std::min(hi, kmax + 2);
+
+        rot.clear();
+        for (int t = t0; t < t1; t++) {
+          for (int j = 0; j < num_shifts; j++) {
+            const int k = lo + t - 2 * j;
+            if (k < lo || k > hi - 1) continue;
+
+            // Introduce the bulge with the shift, else chase it down
+            Givens g = (k == lo) ? makeGivens(k, H[k][k] - shifts[j], H[k + 1][k]) :
+                                   makeGivens(k, H[k][k - 1], H[k + 1][k - 1]);
+            if (k > lo) {
+              H[k][k - 1] = g.c * H[k][k - 1] + g.s * H[k + 1][k - 1];
+              H[k + 1][k - 1] = 0.0;
+            }
+
+            for (int c = k; c <= whi; c++) rotateRows(g, H[k][c], H[k + 1][c]);
+            for (int r = wlo; r <= std::min(k + 2, hi); r++) rotateCols(g, H[r][k], H[r][k + 1]);
+            rot.push_back(g);
+          }
+        }
 
-    // Rotate R and V, i.e. H->RQ. V->VQ
-    // Loop over columns of upper Hessenberg
-    for (int j = 0; j < n_kr - 1; j++) {
-      if (abs(R11[j]) > tol) {
-        // Loop over the rows, up to the sub diagonal element i=j+1
+        // Apply the accumulated rotations to the rest of H and to Q,
+        // threading over the independent rows and columns
 #ifdef _OPENMP
 #pragma omp parallel
         {
-#pragma omp for schedule(static, 32) nowait
+#pragma omp for nowait
 #endif
-          for (int i = 0; i < j + 2; i++) {
-            Complex temp = R[i][j];
-            R[i][j] -= (R11[j] * temp + R12[j] * R[i][j + 1]);
-            R[i][j + 1] -= (R21[j] * temp + R22[j] * R[i][j + 1]);
-          }
+          for (int c = whi + 1; c < n; c++)
+            for (auto &g : rot) rotateRows(g, H[g.k][c], H[g.k + 1][c]);
 #ifdef _OPENMP
-#pragma omp for schedule(static, 32) nowait
+#pragma omp for nowait
 #endif
-          for (int i = 0; i < n_kr; i++) {
-            Complex temp = Q[i][j];
-            Q[i][j] -= (R11[j] * temp + R12[j] * Q[i][j + 1]);
-            Q[i][j + 1] -= (R21[j] * temp + R22[j] * Q[i][j + 1]);
-          }
+          for (int r = 0; r < wlo; r++)
+            for (auto &g : rot) rotateCols(g, H[r][g.k], H[r][g.k + 1]);
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+          for (int r = 0; r < n; r++)
+            for (auto &g : rot) rotateCols(g, Q[r][g.k], Q[r][g.k + 1]);
 #ifdef _OPENMP
         }
 #endif
       }
+
+      lo = hi + 1;
     }
   }
 
@@ -384,14 +409,8 @@ namespace quda
             // Deduce the better eval to shift
             eval = Rmat[i + 1][i + 1] + (norm(sol1) < norm(sol2) ? sol1 : sol2);
 
-            // Shift the eigenvalue
-            for (int j = 0; j < n_kr; j++) Rmat[j][j] -= eval;
-
-            // Do the QR iteration
-            qrIteration(Qmat, Rmat);
-
-            // Shift back
-            for (int j = 0; j < n_kr; j++) Rmat[j][j] += eval;
+            // Do the implicitly shifted QR iteration
+            qrChase(Qmat, Rmat, n_kr, &eval, 1, tol);
           }
           iter++;
         }
@@ -280,10 +280,7 @@ namespace quda
     // int arrow_pos = std::max(num_keep - num_locked + 1, 2);
     int arrow_pos = num_keep - num_locked;
 
-    // Eigen objects
-    MatrixXd A = MatrixXd::Zero(dim, dim);
     ritz_mat.resize(dim * dim);
-    for (int i = 0; i < dim * dim; i++) ritz_mat[i] = 0.0;
 
     // Invert the spectrum due to chebyshev
     if (reverse) {
@@ -294,41 +291,57 @@ namespace quda
       alpha[n_kr - 1] *= -1.0;
     }
 
-    // Construct arrow mat A_{dim,dim}
-    for (int i = 0; i < dim; i++) {
+    if (eig_param->use_eigen_arrow) {
+      // Eigen objects
+      MatrixXd A = MatrixXd::Zero(dim, dim);
 
-      // alpha populates the diagonal
-      A(i, i) = alpha[i + num_locked];
-    }
+      // Construct arrow mat A_{dim,dim}
+      for (int i = 0; i < dim; i++) {
 
-    for (int i = 0; i < arrow_pos; i++) {
+        // alpha populates the diagonal
+        A(i, i) = alpha[i + num_locked];
+      }
 
-      // beta populates the arrow
-      A(i, arrow_pos) = beta[i + num_locked];
-      A(arrow_pos, i) = beta[i + num_locked];
-    }
+      for (int i = 0; i < arrow_pos; i++) {
 
-    for (int i = arrow_pos; i < dim - 1; i++) {
+        // beta populates the arrow
+        A(i, arrow_pos) = beta[i + num_locked];
+        A(arrow_pos, i) = beta[i + num_locked];
+      }
 
-      // beta populates the sub-diagonal
-      A(i, i + 1) = beta[i + num_locked];
-      A(i + 1, i) = beta[i + num_locked];
-    }
+      for (int i = arrow_pos; i < dim - 1; i++) {
 
-    // Eigensolve the arrow matrix
-    SelfAdjointEigenSolver<MatrixXd> eigensolver;
-    eigensolver.compute(A);
+        // beta populates the sub-diagonal
+        A(i, i + 1) = beta[i + num_locked];
+        A(i + 1, i) = beta[i + num_locked];
+      }
 
-    // repopulate ritz matrix
-    for (int i = 0; i < dim; i++)
-      for (int j = 0; j < dim; j++) ritz_mat[dim * i + j] = eigensolver.eigenvectors().col(i)[j];
+      // Eigensolve the arrow matrix
+      SelfAdjointEigenSolver<MatrixXd> eigensolver;
+      eigensolver.compute(A);
+
+      // repopulate ritz matrix
+      for (int i = 0; i < dim; i++)
+        for (int j = 0; j < dim; j++) ritz_mat[dim * i + j] = eigensolver.eigenvectors().col(i)[j];
 
-    for (int i = 0; i < dim; i++) {
-      residua[i + num_locked] = fabs(beta[n_kr - 1] * eigensolver.eigenvectors().col(i)[dim - 1]);
       // Update the alpha array
-      alpha[i + num_locked] = eigensolver.eigenvalues()[i];
+      for (int i = 0; i < dim; i++) alpha[i + num_locked] = eigensolver.eigenvalues()[i];
+    } else {
+      // Exploit the arrow structure: the secular equation gives the
+      // eigenvalues in O(dim^2), but accumulating the eigenvectors of
+      // the sub-problems is still O(dim^3), with a much smaller prefactor
+      // than the dense solver
+      std::vector<double> diag(alpha + num_locked, alpha + n_kr);
+      std::vector<double> off(beta + num_locked, beta + n_kr - 1);
+      std::vector<double> evals;
+      arrowEigensolve(arrow_pos, diag, off, evals, ritz_mat);
+
+      // Update the alpha array
+      for (int i = 0; i < dim; i++) alpha[i + num_locked] = evals[i];
     }
 
+    for (int i = 0; i < dim; i++) residua[i + num_locked] = fabs(beta[n_kr - 1] * ritz_mat[dim * i + dim - 1]);
+
     // Put spectrum back in order
     if (reverse) {
       for (int i = num_locked; i < n_kr; i++) { alpha[i] *= -1.0; }
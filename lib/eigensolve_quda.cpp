@@ -4,6 +4,7 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #include <quda_internal.h>
 #include <eigensolve_quda.h>
@@ -270,7 +271,7 @@ namespace quda
         }
       }
       // save the vectors
-      VectorIO io(eig_param->vec_outfile, eig_param->io_parity_inflate == QUDA_BOOLEAN_TRUE);
+      VectorIO io(eig_param->vec_outfile, eig_param->io_parity_inflate == QUDA_BOOLEAN_TRUE, eig_param->io_chunk_size);
       io.save(vecs_ptr);
       for (unsigned int i = 0; i < kSpace.size() && save_prec < prec; i++) delete vecs_ptr[i];
     }
@@ -795,7 +796,7 @@ namespace quda
 
     {
       // load the vectors
-      VectorIO io(eig_param->vec_infile, eig_param->io_parity_inflate == QUDA_BOOLEAN_TRUE);
+      VectorIO io(eig_param->vec_infile, eig_param->io_parity_inflate == QUDA_BOOLEAN_TRUE, eig_param->io_chunk_size);
       io.load(vecs_ptr);
     }
 
@@ -907,9 +908,84 @@ namespace quda
     }
   }
 
+  namespace
+  {
+    // target size in bytes of the per-thread block of vector data used in the host rotation
+    constexpr size_t host_rotate_block_bytes = 256 * 1024;
+
+    /**
+       @brief In-place rotation of host resident vectors, v_i <- sum_j
+       v_j * rot[j * keep + i] for i < keep, performed as a
+       cache-blocked GEMM: the vector data are processed in blocks
+       small enough that all dim inputs of a block stay in cache, so
+       each vector is streamed exactly once and no workspace vectors
+       are required.
+       @param[in,out] vecs The dim vectors to rotate
+       @param[in] rot The row-major dim x keep rotation matrix
+       @param[in] keep The number of rotated vectors
+    */
+    template <typename Float, typename T>
+    void rotateVecsHost(std::vector<ColorSpinorField *> &vecs, const T *rot, int keep)
+    {
+      using complex_t = typename std::conditional<std::is_same<T, Complex>::value, std::complex<Float>, Float>::type;
+      const int dim = vecs.size();
+      const size_t length = vecs[0]->Length() / (sizeof(complex_t) / sizeof(Float));
+      const size_t block = std::max(host_rotate_block_bytes / (dim * sizeof(T)), static_cast<size_t>(8));
+      const size_t n_block = (length + block - 1) / block;
+
+      std::vector<complex_t *> v(dim);
+      for (int j = 0; j < dim; j++) v[j] = static_cast<complex_t *>(vecs[j]->V());
+
+#pragma omp parallel
+      {
+        std::vector<T> in(dim * block);
+        std::vector<T> out(block);
+
+#pragma omp for schedule(static)
+        for (size_t b = 0; b < n_block; b++) {
+          const size_t x0 = b * block;
+          const size_t n = std::min(block, length - x0);
+
+          for (int j = 0; j < dim; j++)
+            for (size_t x = 0; x < n; x++) in[j * block + x] = v[j][x0 + x];
+
+          for (int i = 0; i < keep; i++) {
+            for (size_t x = 0; x < n; x++) out[x] = 0.0;
+            for (int j = 0; j < dim; j++) {
+              const T a = rot[j * keep + i];
+              const T *in_j = in.data() + j * block;
+              for (size_t x = 0; x < n; x++) out[x] += a * in_j[x];
+            }
+            for (size_t x = 0; x < n; x++) v[i][x0 + x] = out[x];
+          }
+        }
+      }
+    }
+
+    template <typename T>
+    void rotateVecsHost(std::vector<ColorSpinorField *> &kSpace, const T *rot, int dim, int keep, int locked)
+    {
+      std::vector<ColorSpinorField *> vecs(kSpace.begin() + locked, kSpace.begin() + locked + dim);
+      switch (vecs[0]->Precision()) {
+      case QUDA_DOUBLE_PRECISION: rotateVecsHost<double>(vecs, rot, keep); break;
+      case QUDA_SINGLE_PRECISION: rotateVecsHost<float>(vecs, rot, keep); break;
+      default: errorQuda("Unsupported precision %d for host rotation", vecs[0]->Precision());
+      }
+    }
+  } // namespace
+
   void EigenSolver::rotateVecsComplex(std::vector<ColorSpinorField *> &kSpace, const Complex *rot_array, const int offset,
                                       const int dim, const int keep, const int locked, TimeProfile &profile)
   {
+    // Host resident vectors are rotated in place, block by block,
+    // so need neither workspace vectors nor the LU decomposition
+    if (kSpace[0]->Location() == QUDA_CPU_FIELD_LOCATION) {
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      rotateVecsHost(kSpace, rot_array, dim, keep, locked);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      return;
+    }
+
     // If we have memory availible, do the entire rotation
     if (batched_rotate <= 0 || batched_rotate >= keep) {
       if ((int)kSpace.size() < offset + keep) {
@@ -1054,6 +1130,15 @@ namespace quda
   void EigenSolver::rotateVecs(std::vector<ColorSpinorField *> &kSpace, const double *rot_array, const int offset,
                                const int dim, const int keep, const int locked, TimeProfile &profile)
   {
+    // Host resident vectors are rotated in place, block by block,
+    // so need neither workspace vectors nor the LU decomposition
+    if (kSpace[0]->Location() == QUDA_CPU_FIELD_LOCATION) {
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      rotateVecsHost(kSpace, rot_array, dim, keep, locked);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      return;
+    }
+
     // If we have memory availible, do the entire rotation
     if (batched_rotate <= 0 || batched_rotate >= keep) {
       if ((int)kSpace.size() < offset + keep) {
@@ -109,6 +109,8 @@ namespace quda {
 	int D0 = extract ? dir*arg.X[dim] + (1-dir)*arg.R[dim] : dir*(arg.X[dim] + arg.R[dim]); 
 	  
 	for (int d=D0; d<D0+arg.R[dim]; d++) {
+          // each (a,b,c,d) site maps to a distinct buffer element so we can thread over the surface
+#pragma omp parallel for
 	  for (int a=arg.A0[dim]; a<arg.A1[dim]; a++) { // loop over the interior surface
 	    for (int b=arg.B0[dim]; b<arg.B1[dim]; b++) { // loop over the interior surface
 	      for (int c=arg.C0[dim]; c<arg.C1[dim]; c++) { // loop over the interior surface
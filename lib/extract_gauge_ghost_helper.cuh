@@ -38,6 +38,39 @@ namespace quda {
     }
   };
 
+  /**
+     Extract (or inject) the ghost element at surface coordinate
+     (a,b,c,d) of dimension dim into (from) ghost index indexGhost.
+  */
+  template <bool extract, typename Arg>
+  __host__ inline void extractGhostSite(Arg &arg, int parity, int dim, int indexCB, int indexGhost)
+  {
+    using real = typename Arg::real;
+    constexpr int nColor = Arg::nColor;
+#ifdef FINE_GRAINED_ACCESS
+    for (int i=0; i<nColor; i++) {
+      for (int j=0; j<nColor; j++) {
+        if (extract) {
+          arg.order.Ghost(dim, (parity+arg.localParity[dim])&1, indexGhost, i, j)
+            = arg.order(dim+arg.offset, parity, indexCB, i, j);
+        } else { // injection
+          arg.order(dim+arg.offset, parity, indexCB, i, j)
+            = arg.order.Ghost(dim, (parity+arg.localParity[dim])&1, indexGhost, i, j);
+        }
+      }
+    }
+#else
+    if (extract) {
+      // load the ghost element from the bulk
+      Matrix<complex<real>, nColor> u = arg.order(dim+arg.offset, indexCB, parity);
+      arg.order.Ghost(dim, indexGhost, (parity+arg.localParity[dim])&1) = u;
+    } else { // injection
+      Matrix <complex<real>, nColor> u = arg.order.Ghost(dim, indexGhost, (parity+arg.localParity[dim])&1);
+      arg.order(dim+arg.offset, indexCB, parity) = u; // save the ghost element to the bulk
+    }
+#endif
+  }
+
   /**
      Generic CPU gauge ghost extraction and packing
      NB This routines is specialized to four dimensions
@@ -45,9 +78,6 @@ namespace quda {
   template <int nDim, bool extract, typename Arg>
   void extractGhost(Arg &arg)
   {
-    using real = typename Arg::real;
-    constexpr int nColor = Arg::nColor;
-
     for (int parity=0; parity<2; parity++) {
 
       for (int dim=0; dim<nDim; dim++) {
@@ -55,6 +85,29 @@ namespace quda {
 	// for now we never inject unless we have partitioned in that dimension
 	if (!arg.commDim[dim] && !extract) continue;
 
+        if (arg.C[dim] % 2 == 0) {
+          // parity alternates along c, so the ghost index is the
+          // linear surface index halved: thread over the surface
+          const int faceVolume = 2 * arg.faceVolumeCB[dim];
+#pragma omp parallel for
+          for (int X=0; X<faceVolume; X++) {
+            // X = ((d * A + a)*B + b)*C + c
+            int dab = X/arg.C[dim];
+            int c = X - dab*arg.C[dim];
+            int da = dab/arg.B[dim];
+            int b = dab - da*arg.B[dim];
+            int d = da / arg.A[dim];
+            int a = da - d * arg.A[dim];
+            d += arg.X[dim]-arg.nFace;
+
+            // we only do the extraction for parity we are currently working on
+            if (((a+b+c+d) & 1) != parity) continue;
+            int indexCB = (a*arg.f[dim][0] + b*arg.f[dim][1] + c*arg.f[dim][2] + d*arg.f[dim][3]) >> 1;
+            extractGhostSite<extract>(arg, parity, dim, indexCB, X >> 1);
+          }
+          continue;
+        }
+
 	// linear index used for reading/writing into ghost buffer
 	int indexGhost = 0;
 	// the following 4-way loop means this is specialized for 4 dimensions
@@ -69,28 +122,7 @@ namespace quda {
 		// we only do the extraction for parity we are currently working on
 		int oddness = (a+b+c+d) & 1;
 		if (oddness == parity) {
-#ifdef FINE_GRAINED_ACCESS
-		  for (int i=0; i<nColor; i++) {
-		    for (int j=0; j<nColor; j++) {
-		      if (extract) {
-			arg.order.Ghost(dim, (parity+arg.localParity[dim])&1, indexGhost, i, j)
-			  = arg.order(dim+arg.offset, parity, indexCB, i, j);
-		      } else { // injection
-			arg.order(dim+arg.offset, parity, indexCB, i, j)
-			  = arg.order.Ghost(dim, (parity+arg.localParity[dim])&1, indexGhost, i, j);
-		      }
-		    }
-		  }
-#else
-		  if (extract) {
-                    // load the ghost element from the bulk
-                    Matrix<complex<real>, nColor> u = arg.order(dim+arg.offset, indexCB, parity);
-		    arg.order.Ghost(dim, indexGhost, (parity+arg.localParity[dim])&1) = u;
-		  } else { // injection
-		    Matrix <complex<real>, nColor> u = arg.order.Ghost(dim, indexGhost, (parity+arg.localParity[dim])&1);
-		    arg.order(dim+arg.offset, indexCB, parity) = u; // save the ghost element to the bulk
-		  }
-#endif
+                  extractGhostSite<extract>(arg, parity, dim, indexCB, indexGhost);
 		  indexGhost++;
 		} // oddness == parity
 	      } // c
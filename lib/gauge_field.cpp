@@ -171,9 +171,9 @@ namespace quda {
     staggeredPhaseApplied = false;
   }
 
-  void GaugeField::exchange(void **ghost_link, void **link_sendbuf, QudaDirection dir) const {
-    MsgHandle *mh_send[4];
-    MsgHandle *mh_recv[4];
+  void GaugeField::exchange(void **ghost_link, void **link_sendbuf, QudaDirection dir, int n_set) const {
+    MsgHandle *mh_send[2 * QUDA_MAX_DIM];
+    MsgHandle *mh_recv[2 * QUDA_MAX_DIM];
     size_t bytes[4];
 
     for (int i=0; i<nDimComms; i++) bytes[i] = 2*nFace*surfaceCB[i]*nInternal*precision;
@@ -185,68 +185,81 @@ namespace quda {
     // should probably be cleaned up.
     bool no_comms_fill = (dir == QUDA_BACKWARDS) ? false : true;
 
-    void *send[4];
-    void *receive[4];
+    // buffers are ordered [set][dim]
+    const int n = n_set * nDimComms;
+
+    void *send[2 * QUDA_MAX_DIM];
+    void *receive[2 * QUDA_MAX_DIM];
     if (Location() == QUDA_CPU_FIELD_LOCATION) {
-      for (int i=0; i<nDimComms; i++) {
+      for (int k=0; k<n; k++) {
+        int i = k % nDimComms;
 	if (comm_dim_partitioned(i)) {
-	  send[i] = link_sendbuf[i];
-	  receive[i] = ghost_link[i];
+	  send[k] = link_sendbuf[k];
+	  receive[k] = ghost_link[k];
 	} else {
-	  if (no_comms_fill) memcpy(ghost_link[i], link_sendbuf[i], bytes[i]);
+	  if (no_comms_fill) memcpy(ghost_link[k], link_sendbuf[k], bytes[i]);
 	}
       }
     } else { // FIXME for CUDA field copy back to the CPU
-      for (int i=0; i<nDimComms; i++) {
+      for (int k=0; k<n; k++) {
+        int i = k % nDimComms;
 	if (comm_dim_partitioned(i)) {
-	  send[i] = pool_pinned_malloc(bytes[i]);
-	  receive[i] = pool_pinned_malloc(bytes[i]);
-	  qudaMemcpy(send[i], link_sendbuf[i], bytes[i], cudaMemcpyDeviceToHost);
+	  send[k] = pool_pinned_malloc(bytes[i]);
+	  receive[k] = pool_pinned_malloc(bytes[i]);
+	  qudaMemcpy(send[k], link_sendbuf[k], bytes[i], cudaMemcpyDeviceToHost);
 	} else {
-	  if (no_comms_fill) qudaMemcpy(ghost_link[i], link_sendbuf[i], bytes[i], cudaMemcpyDeviceToDevice);
+	  if (no_comms_fill) qudaMemcpy(ghost_link[k], link_sendbuf[k], bytes[i], cudaMemcpyDeviceToDevice);
 	}
       }
     }
 
-    for (int i=0; i<nDimComms; i++) {
+    for (int k=0; k<n; k++) {
+      int i = k % nDimComms;
       if (!comm_dim_partitioned(i)) continue;
+      // distinct link sets in the same dimension are disambiguated by message order
       if (dir == QUDA_FORWARDS) {
-	mh_send[i] = comm_declare_send_relative(send[i], i, +1, bytes[i]);
-	mh_recv[i] = comm_declare_receive_relative(receive[i], i, -1, bytes[i]);
+	mh_send[k] = comm_declare_send_relative(send[k], i, +1, bytes[i]);
+	mh_recv[k] = comm_declare_receive_relative(receive[k], i, -1, bytes[i]);
       } else if (dir == QUDA_BACKWARDS) {
-	mh_send[i] = comm_declare_send_relative(send[i], i, -1, bytes[i]);
-	mh_recv[i] = comm_declare_receive_relative(receive[i], i, +1, bytes[i]);
+	mh_send[k] = comm_declare_send_relative(send[k], i, -1, bytes[i]);
+	mh_recv[k] = comm_declare_receive_relative(receive[k], i, +1, bytes[i]);
       } else {
 	errorQuda("Unsuported dir=%d", dir);
       }
 
     }
 
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      comm_start(mh_send[i]);
-      comm_start(mh_recv[i]);
+    // post all receives and sends for all dimensions (and sets) up front
+    for (int k=0; k<n; k++) {
+      if (!comm_dim_partitioned(k % nDimComms)) continue;
+      comm_start(mh_recv[k]);
     }
 
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      comm_wait(mh_send[i]);
-      comm_wait(mh_recv[i]);
+    for (int k=0; k<n; k++) {
+      if (!comm_dim_partitioned(k % nDimComms)) continue;
+      comm_start(mh_send[k]);
+    }
+
+    for (int k=0; k<n; k++) {
+      if (!comm_dim_partitioned(k % nDimComms)) continue;
+      comm_wait(mh_send[k]);
+      comm_wait(mh_recv[k]);
     }
 
     if (Location() == QUDA_CUDA_FIELD_LOCATION) {
-      for (int i=0; i<nDimComms; i++) {
+      for (int k=0; k<n; k++) {
+        int i = k % nDimComms;
 	if (!comm_dim_partitioned(i)) continue;
-	qudaMemcpy(ghost_link[i], receive[i], bytes[i], cudaMemcpyHostToDevice);
-	pool_pinned_free(send[i]);
-	pool_pinned_free(receive[i]);
+	qudaMemcpy(ghost_link[k], receive[k], bytes[i], cudaMemcpyHostToDevice);
+	pool_pinned_free(send[k]);
+	pool_pinned_free(receive[k]);
       }
     }
 
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      comm_free(mh_send[i]);
-      comm_free(mh_recv[i]);
+    for (int k=0; k<n; k++) {
+      if (!comm_dim_partitioned(k % nDimComms)) continue;
+      comm_free(mh_send[k]);
+      comm_free(mh_recv[k]);
     }
 
   }
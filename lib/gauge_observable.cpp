@@ -6,6 +6,25 @@ namespace quda
 
   void gaugeObservables(GaugeField &u, QudaGaugeObservableParam &param, TimeProfile &profile)
   {
+    if (u.Location() == QUDA_CPU_FIELD_LOCATION) {
+      // host fields are measured in place, with Fmunu formed on the fly
+      if (param.su_project) errorQuda("SU(3) projection not supported on host fields");
+      if (param.compute_qcharge_density && !param.qcharge_density)
+        errorQuda("Charge density requested, but destination field not defined");
+      const bool fmunu = param.compute_qcharge || param.compute_qcharge_density;
+      GaugeObservablesCPU obs;
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+      gaugeObservablesCPU(obs, u, fmunu, param.compute_qcharge_density ? param.qcharge_density : nullptr);
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      if (param.compute_plaquette)
+        for (int i = 0; i < 3; i++) param.plaquette[i] = obs.plaquette[i];
+      if (fmunu) {
+        for (int i = 0; i < 3; i++) param.energy[i] = obs.energy[i];
+        param.qcharge = obs.qcharge;
+      }
+      return;
+    }
+
     profile.TPSTART(QUDA_PROFILE_COMPUTE);
     if (param.su_project) {
       int *num_failures_h = static_cast<int *>(pool_pinned_malloc(sizeof(int)));
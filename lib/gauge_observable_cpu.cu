@@ -0,0 +1,217 @@
+#include <gauge_field.h>
+#include <gauge_tools.h>
+#include <gauge_field_order.h>
+#include <quda_matrix.h>
+#include <index_helper.cuh>
+
+namespace quda
+{
+
+  template <typename Float, typename Gauge> struct GaugeObservablesCPUArg {
+    using real = typename mapper<Float>::type;
+    using Link = Matrix<complex<real>, 3>;
+
+    const Gauge U;
+    int E[4];      // extended grid dimensions
+    int X[4];      // true grid dimensions
+    int border[4]; // width of the halo
+    Float *qDensity;
+
+    GaugeObservablesCPUArg(const GaugeField &u, void *qDensity) : U(u), qDensity(static_cast<Float *>(qDensity))
+    {
+      for (int dir = 0; dir < 4; dir++) {
+        border[dir] = u.R()[dir];
+        E[dir] = u.X()[dir];
+        X[dir] = u.X()[dir] - 2 * border[dir];
+      }
+    }
+
+    /**
+       @brief Load the link in direction mu at extended coordinate x + dx
+    */
+    inline Link link(int mu, const int x[4], const int dx[4]) const
+    {
+      const int parity = (x[0] + x[1] + x[2] + x[3] + dx[0] + dx[1] + dx[2] + dx[3]) & 1;
+      return U(mu, linkIndexShift(x, dx, E), parity);
+    }
+  };
+
+  /**
+     @brief Compute the clover-leaf field strength F_{mu nu}(x), with
+     mu > nu, using the same leaf ordering and normalization as
+     computeFmunuCore, and return the trace of its first leaf (the
+     plaquette at x) through plaq.
+  */
+  template <typename Arg>
+  inline typename Arg::Link cloverLeaf(const Arg &arg, const int x[4], int mu, int nu, double &plaq)
+  {
+    using Link = typename Arg::Link;
+    int dx[4] = {0, 0, 0, 0};
+
+    // U(x,mu) U(x+mu,nu) U[dagger](x+nu,mu) U[dagger](x,nu)
+    Link U1 = arg.link(mu, x, dx);
+    dx[mu]++;
+    Link U2 = arg.link(nu, x, dx);
+    dx[mu]--;
+    dx[nu]++;
+    Link U3 = arg.link(mu, x, dx);
+    dx[nu]--;
+    Link U4 = arg.link(nu, x, dx);
+    Link F = U1 * U2 * conj(U3) * conj(U4);
+    plaq = getTrace(F).real();
+
+    // U(x,nu) U[dagger](x+nu-mu,mu) U[dagger](x-mu,nu) U(x-mu, mu)
+    dx[nu]++;
+    dx[mu]--;
+    U2 = arg.link(mu, x, dx);
+    dx[nu]--;
+    U3 = arg.link(nu, x, dx);
+    Link U5 = arg.link(mu, x, dx);
+    dx[mu]++;
+    F += U4 * conj(U2) * conj(U3) * U5;
+
+    // U[dagger](x-nu,nu) U(x-nu,mu) U(x+mu-nu,nu) U[dagger](x,mu)
+    dx[nu]--;
+    Link U6 = arg.link(nu, x, dx);
+    Link U7 = arg.link(mu, x, dx);
+    dx[mu]++;
+    Link U8 = arg.link(nu, x, dx);
+    dx[mu]--;
+    dx[nu]++;
+    F += conj(U6) * U7 * U8 * conj(U1);
+
+    // U[dagger](x-mu,mu) U[dagger](x-mu-nu,nu) U(x-mu-nu,mu) U(x-nu,nu)
+    dx[mu]--;
+    dx[nu]--;
+    Link U9 = arg.link(nu, x, dx);
+    Link U10 = arg.link(mu, x, dx);
+    dx[mu]++;
+    dx[nu]++;
+    F += conj(U5) * conj(U9) * U10 * U6;
+
+    F -= conj(F);
+    F *= static_cast<typename Arg::real>(0.125);
+    return F;
+  }
+
+  template <typename Float, typename Gauge>
+  void gaugeObservablesCPU(GaugeObservablesCPU &obs, const GaugeField &u, bool fmunu, void *qcharge_density)
+  {
+    using Arg = GaugeObservablesCPUArg<Float, Gauge>;
+    using real = typename Arg::real;
+    using Link = typename Arg::Link;
+    const Arg arg(u, qcharge_density);
+    const int *X = arg.X;
+    const long volume = static_cast<long>(X[0]) * X[1] * X[2] * X[3];
+    constexpr real n_inv = static_cast<real>(1.0 / 3.0);
+    constexpr double q_norm = -1.0 / (4 * M_PI * M_PI);
+
+    double plaq_s = 0.0, plaq_t = 0.0, E_s = 0.0, E_t = 0.0, Q = 0.0;
+
+    // every link and staple is shared with the neighbouring sites of
+    // the same (x, y) plane or the adjacent planes, so each thread
+    // sweeps whole planes to keep them in cache
+#pragma omp parallel for collapse(2) schedule(static) reduction(+ : plaq_s, plaq_t, E_s, E_t, Q)
+    for (int t = 0; t < X[3]; t++) {
+      for (int z = 0; z < X[2]; z++) {
+        for (int y = 0; y < X[1]; y++) {
+          for (int x0 = 0; x0 < X[0]; x0++) {
+            const int x[4] = {x0 + arg.border[0], y + arg.border[1], z + arg.border[2], t + arg.border[3]};
+
+            // F0 = F[Y,X], F1 = F[Z,X], F2 = F[Z,Y], F3 = F[T,X], F4 = F[T,Y], F5 = F[T,Z]
+            Link F[6];
+            for (int mu = 1, i = 0; mu < 4; mu++) {
+              for (int nu = 0; nu < mu; nu++, i++) {
+                double p;
+                if (fmunu) {
+                  F[i] = cloverLeaf(arg, x, mu, nu, p);
+                } else {
+                  int dx[4] = {0, 0, 0, 0};
+                  Link W = arg.link(mu, x, dx);
+                  dx[mu]++;
+                  W = W * arg.link(nu, x, dx);
+                  dx[mu]--;
+                  dx[nu]++;
+                  W = W * conj(arg.link(mu, x, dx));
+                  dx[nu]--;
+                  p = getTrace(W * conj(arg.link(nu, x, dx))).real();
+                }
+                if (mu < 3) plaq_s += p;
+                else plaq_t += p;
+              }
+            }
+            if (!fmunu) continue;
+
+            Link iden;
+            setIdentity(&iden);
+            for (int i = 0; i < 6; i++) {
+              auto tmp = F[i] - n_inv * getTrace(F[i]) * iden;
+              if (i < 3) E_s -= getTrace(tmp * tmp).real();
+              else E_t -= getTrace(tmp * tmp).real();
+            }
+
+            double Q_idx = 0.0;
+            for (int i = 0; i < 3; i++) {
+              const double Qi = getTrace(F[i] * F[5 - i]).real();
+              i % 2 == 0 ? Q_idx += Qi : Q_idx -= Qi;
+            }
+            Q += Q_idx * q_norm;
+            if (arg.qDensity) {
+              const int parity = (x0 + y + z + t) & 1;
+              const int x_cb = ((((t * X[2] + z) * X[1] + y) * X[0]) + x0) >> 1;
+              arg.qDensity[x_cb + parity * (volume / 2)] = Q_idx * q_norm;
+            }
+          }
+        }
+      }
+    }
+
+    double result[5] = {plaq_s, plaq_t, E_s, E_t, Q};
+    comm_allreduce_array(result, 5);
+    const double norm = volume * comm_size();
+    // each site has three planes of each type and each trace is normalized by nColor
+    obs.plaquette[1] = result[0] / (9.0 * norm);
+    obs.plaquette[2] = result[1] / (9.0 * norm);
+    obs.plaquette[0] = 0.5 * (obs.plaquette[1] + obs.plaquette[2]);
+    obs.energy[1] = fmunu ? result[2] / norm : 0.0;
+    obs.energy[2] = fmunu ? result[3] / norm : 0.0;
+    obs.energy[0] = obs.energy[1] + obs.energy[2];
+    obs.qcharge = fmunu ? result[4] : 0.0;
+
+  }
+
+  template <typename Float>
+  void gaugeObservablesCPU(GaugeObservablesCPU &obs, const GaugeField &u, bool fmunu, void *qcharge_density)
+  {
+    constexpr int length = 18;
+    if (u.Order() == QUDA_QDP_GAUGE_ORDER) {
+      gaugeObservablesCPU<Float, gauge::QDPOrder<Float, length>>(obs, u, fmunu, qcharge_density);
+    } else if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
+      gaugeObservablesCPU<Float, gauge::MILCOrder<Float, length>>(obs, u, fmunu, qcharge_density);
+    } else {
+      errorQuda("Gauge field order %d not supported on host", u.Order());
+    }
+  }
+
+  void gaugeObservablesCPU(GaugeObservablesCPU &obs, const GaugeField &u, bool fmunu, void *qcharge_density)
+  {
+    if (u.Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Expected a host gauge field");
+    if (u.Ncolor() != 3) errorQuda("Unsupported number of colors %d", u.Ncolor());
+    if (u.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Unsupported reconstruct %d", u.Reconstruct());
+    if (u.Geometry() != QUDA_VECTOR_GEOMETRY) errorQuda("Unsupported geometry %d", u.Geometry());
+    // the clover leaves reach one site past the local volume
+    for (int d = 0; d < 4; d++) {
+      if (comm_dim_partitioned(d) && u.R()[d] < 1)
+        errorQuda("Host observables need a halo in partitioned dimension %d", d);
+    }
+
+    if (u.Precision() == QUDA_DOUBLE_PRECISION) {
+      gaugeObservablesCPU<double>(obs, u, fmunu, qcharge_density);
+    } else if (u.Precision() == QUDA_SINGLE_PRECISION) {
+      gaugeObservablesCPU<float>(obs, u, fmunu, qcharge_density);
+    } else {
+      errorQuda("Unsupported precision %d", u.Precision());
+    }
+  }
+
+} // namespace quda
@@ -0,0 +1,233 @@
+#include <vector>
+#include <gauge_field.h>
+#include <gauge_tools.h>
+#include <gauge_field_order.h>
+#include <quda_matrix.h>
+#include <index_helper.cuh>
+#include <su3_project.cuh>
+#include <kernels/gauge_utils.cuh>
+
+namespace quda
+{
+
+  template <typename Float, typename Gauge> struct GaugeSmearCPUArg {
+    using real = typename mapper<Float>::type;
+    using Link = Matrix<complex<real>, 3>;
+
+    Gauge in;      // field updated in place, read by computeStaple as arg.in
+    int E[4];      // extended grid dimensions
+    int X[4];      // true grid dimensions
+    int border[4]; // width of the halo
+    int volumeCB;  // local checkerboard volume
+    int nDim;      // number of link directions that are updated
+    std::vector<Link> K; // per-link accumulator over the local volume
+
+    GaugeSmearCPUArg(GaugeField &u, int nDim) : in(u), volumeCB(1), nDim(nDim)
+    {
+      for (int dir = 0; dir < 4; dir++) {
+        border[dir] = u.R()[dir];
+        E[dir] = u.X()[dir];
+        X[dir] = u.X()[dir] - 2 * border[dir];
+        volumeCB *= X[dir];
+      }
+      volumeCB /= 2;
+      K.resize(2 * nDim * volumeCB);
+    }
+
+    inline Link &acc(int dir, int parity, int x_cb) { return K[(dir * 2 + parity) * volumeCB + x_cb]; }
+  };
+
+  /**
+     @brief Apply f(x, parity, dir, U, K) to every local link, where x is
+     the extended coordinate of the site, parity its parity on the
+     extended lattice, U the link in place and K its accumulator.
+     Sites are swept in (t,z) planes as in gaugeObservablesCPU.
+  */
+  template <typename Arg, typename F> void forEachLinkCPU(Arg &arg, F &&f)
+  {
+    const int *X = arg.X;
+#pragma omp parallel for collapse(2) schedule(static)
+    for (int t = 0; t < X[3]; t++) {
+      for (int z = 0; z < X[2]; z++) {
+        for (int y = 0; y < X[1]; y++) {
+          for (int x0 = 0; x0 < X[0]; x0++) {
+            const int x[4] = {x0 + arg.border[0], y + arg.border[1], z + arg.border[2], t + arg.border[3]};
+            const int parity = (x[0] + x[1] + x[2] + x[3]) & 1;
+            const int x_cb = ((((t * X[2] + z) * X[1] + y) * X[0]) + x0) >> 1;
+            const int idx = linkIndex(x, arg.E);
+            const int parity_cb = (x0 + y + z + t) & 1; // parity on the local lattice
+            for (int dir = 0; dir < arg.nDim; dir++)
+              f(x, parity, dir, arg.in(dir, idx, parity), arg.acc(dir, parity_cb, x_cb));
+          }
+        }
+      }
+    }
+  }
+
+  /**
+     @brief Every link update needs its neighbours as they were before
+     the step, so each step is two sweeps: the first stores a
+     per-link update matrix K from the unmodified field, the second
+     applies U <- K U in place and refreshes the halo.  This keeps the
+     working set to the field plus one link per updated direction.
+  */
+  template <typename Arg> void applyUpdateCPU(Arg &arg, GaugeField &u)
+  {
+    using Link = typename Arg::Link;
+    forEachLinkCPU(arg, [&](const int *, int, int, auto &&U, Link &K) { U = K * static_cast<Link>(U); });
+    if (u.R()[0] || u.R()[1] || u.R()[2] || u.R()[3]) u.exchangeExtendedGhost(u.R(), true);
+  }
+
+  template <typename Float, typename Gauge> struct APESmearCPU {
+    static void apply(GaugeField &u, double alpha, unsigned int n_steps)
+    {
+      constexpr int apeDim = 3; // apply APE in space only
+      using Arg = GaugeSmearCPUArg<Float, Gauge>;
+      using real = typename Arg::real;
+      using Link = typename Arg::Link;
+      Arg arg(u, apeDim);
+      const real tol = u.Precision() == QUDA_DOUBLE_PRECISION ? 1e-15 : 2e-6;
+
+      for (unsigned int i = 0; i < n_steps; i++) {
+        forEachLinkCPU(arg, [&](const int *x, int parity, int dir, auto &&U, Link &K) {
+          Link Stap, I;
+          computeStaple(arg, x, arg.E, parity, dir, Stap, apeDim);
+          setIdentity(&I);
+          K = I * static_cast<real>(1.0 - alpha) + Stap * static_cast<real>(alpha / 4.0) * conj(static_cast<Link>(U));
+          polarSu3<real>(K, tol);
+        });
+        applyUpdateCPU(arg, u);
+      }
+    }
+  };
+
+  template <typename Float, typename Gauge> struct STOUTSmearCPU {
+    static void apply(GaugeField &u, double rho, double epsilon, bool improved, unsigned int n_steps)
+    {
+      using Arg = GaugeSmearCPUArg<Float, Gauge>;
+      using real = typename Arg::real;
+      using Link = typename Arg::Link;
+      const int stoutDim = improved ? 4 : 3; // over-improved stouting is applied in all dims
+      Arg arg(u, stoutDim);
+      const real staple_coeff = improved ? rho * (5.0 - 2.0 * epsilon) / 3.0 : rho;
+      const real rectangle_coeff = rho * (1.0 - epsilon) / 12.0;
+
+      for (unsigned int i = 0; i < n_steps; i++) {
+        forEachLinkCPU(arg, [&](const int *x, int parity, int dir, auto &&U, Link &K) {
+          Link Stap, Rect, Q;
+          if (improved) {
+            computeStapleRectangle(arg, x, arg.E, parity, dir, Stap, Rect, stoutDim);
+            Q = (staple_coeff * Stap - rectangle_coeff * Rect) * conj(static_cast<Link>(U));
+          } else {
+            computeStaple(arg, x, arg.E, parity, dir, Stap, stoutDim);
+            Q = (staple_coeff * Stap) * conj(static_cast<Link>(U));
+          }
+          makeHerm(Q);
+          K = exponentiate_iQ(Q);
+        });
+        applyUpdateCPU(arg, u);
+      }
+    }
+  };
+
+  template <typename Float, typename Gauge> struct WFlowIntegratorCPU {
+    static void apply(GaugeField &u, double epsilon, unsigned int n_steps, QudaWFlowType wflow_type, int meas_interval,
+                      std::vector<GaugeObservablesCPU> *obs)
+    {
+      constexpr int wflow_dim = 4; // apply flow in all dims
+      using Arg = GaugeSmearCPUArg<Float, Gauge>;
+      using real = typename Arg::real;
+      using Link = typename Arg::Link;
+      Arg arg(u, wflow_dim);
+
+      // The Runge-Kutta scheme of https://arxiv.org/abs/1006.4518v3 in
+      // 2N-storage form: stage s sets K <- a_s K + b_s Z_s from the force
+      // Z_s of the current field, then U <- exp(c_s epsilon K) U.
+      constexpr double a[3] = {0.0, -17.0 / 36.0, -1.0};
+      constexpr double b[3] = {1.0, 8.0 / 9.0, 3.0 / 4.0};
+      constexpr double c[3] = {1.0 / 4.0, 1.0, 1.0};
+
+      auto measure = [&]() {
+        if (!obs) return;
+        GaugeObservablesCPU o;
+        gaugeObservablesCPU(o, u, true);
+        obs->push_back(o);
+      };
+      measure();
+
+      for (unsigned int i = 0; i < n_steps; i++) {
+        for (int s = 0; s < 3; s++) {
+          forEachLinkCPU(arg, [&](const int *x, int parity, int dir, auto &&U, Link &K) {
+            Link Stap, Rect, F;
+            if (wflow_type == QUDA_WFLOW_TYPE_WILSON) {
+              computeStaple(arg, x, arg.E, parity, dir, Stap, wflow_dim);
+              F = Stap;
+            } else {
+              computeStapleRectangle(arg, x, arg.E, parity, dir, Stap, Rect, wflow_dim);
+              F = static_cast<real>(5.0 / 3.0) * Stap - static_cast<real>(1.0 / 12.0) * Rect;
+            }
+            F = F * conj(static_cast<Link>(U));
+            K = static_cast<real>(a[s]) * K + static_cast<real>(b[s]) * F;
+          });
+
+          forEachLinkCPU(arg, [&](const int *, int, int, auto &&U, Link &K) {
+            Link F = static_cast<real>(c[s] * epsilon) * K;
+            makeAntiHerm(F);
+            F = complex<real>(0.0, -1.0) * F;
+            U = exponentiate_iQ(F) * static_cast<Link>(U);
+          });
+          if (u.R()[0] || u.R()[1] || u.R()[2] || u.R()[3]) u.exchangeExtendedGhost(u.R(), true);
+        }
+        if (meas_interval > 0 && (i + 1) % meas_interval == 0) measure();
+      }
+    }
+  };
+
+  template <template <typename, typename> class Step, typename... Args>
+  void smearCPU(GaugeField &u, int depth, Args... args)
+  {
+    if (u.Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Expected a host gauge field");
+    if (u.Ncolor() != 3) errorQuda("Unsupported number of colors %d", u.Ncolor());
+    if (u.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Unsupported reconstruct %d", u.Reconstruct());
+    if (u.Geometry() != QUDA_VECTOR_GEOMETRY) errorQuda("Unsupported geometry %d", u.Geometry());
+    for (int d = 0; d < 4; d++) {
+      if ((comm_dim_partitioned(d) || u.R()[d]) && u.R()[d] < depth)
+        errorQuda("Host smearing needs a halo of depth %d in dimension %d, have %d", depth, d, u.R()[d]);
+    }
+
+    constexpr int length = 18;
+    if (u.Precision() == QUDA_DOUBLE_PRECISION) {
+      if (u.Order() == QUDA_QDP_GAUGE_ORDER) Step<double, gauge::QDPOrder<double, length>>::apply(u, args...);
+      else if (u.Order() == QUDA_MILC_GAUGE_ORDER) Step<double, gauge::MILCOrder<double, length>>::apply(u, args...);
+      else errorQuda("Gauge field order %d not supported on host", u.Order());
+    } else if (u.Precision() == QUDA_SINGLE_PRECISION) {
+      if (u.Order() == QUDA_QDP_GAUGE_ORDER) Step<float, gauge::QDPOrder<float, length>>::apply(u, args...);
+      else if (u.Order() == QUDA_MILC_GAUGE_ORDER) Step<float, gauge::MILCOrder<float, length>>::apply(u, args...);
+      else errorQuda("Gauge field order %d not supported on host", u.Order());
+    } else {
+      errorQuda("Unsupported precision %d", u.Precision());
+    }
+  }
+
+  void APEStepCPU(GaugeField &u, double alpha, unsigned int n_steps) { smearCPU<APESmearCPU>(u, 1, alpha, n_steps); }
+
+  void STOUTStepCPU(GaugeField &u, double rho, unsigned int n_steps)
+  {
+    smearCPU<STOUTSmearCPU>(u, 1, rho, 0.0, false, n_steps);
+  }
+
+  void OvrImpSTOUTStepCPU(GaugeField &u, double rho, double epsilon, unsigned int n_steps)
+  {
+    smearCPU<STOUTSmearCPU>(u, 2, rho, epsilon, true, n_steps);
+  }
+
+  void WFlowCPU(GaugeField &u, double epsilon, unsigned int n_steps, QudaWFlowType wflow_type, int meas_interval,
+                std::vector<GaugeObservablesCPU> *obs)
+  {
+    if (wflow_type != QUDA_WFLOW_TYPE_WILSON && wflow_type != QUDA_WFLOW_TYPE_SYMANZIK)
+      errorQuda("Unknown Wilson Flow type %d", wflow_type);
+    const int depth = wflow_type == QUDA_WFLOW_TYPE_SYMANZIK ? 2 : 1;
+    smearCPU<WFlowIntegratorCPU>(u, depth, epsilon, n_steps, wflow_type, meas_interval, obs);
+  }
+
+} // namespace quda
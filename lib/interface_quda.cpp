@@ -3,6 +3,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <list>
 #include <sys/time.h>
 #include <complex.h>
 
@@ -17,6 +18,7 @@
 #include <dirac_quda.h>
 #include <dslash_quda.h>
 #include <invert_quda.h>
+#include <chrono_forecast.h>
 #include <eigensolve_quda.h>
 #include <color_spinor_field.h>
 #include <clover_field.h>
@@ -133,7 +135,7 @@ std::vector<cudaColorSpinorField*> solutionResident;
 // vector of spinors used for forecasting solutions in HMC
 #define QUDA_MAX_CHRONO 12
 // each entry is one p
-std::vector< std::vector<ColorSpinorField*> > chronoResident(QUDA_MAX_CHRONO);
+std::vector<ChronoForecast *> chronoResident(QUDA_MAX_CHRONO, nullptr);
 
 // Mapped memory buffer used to hold unitarization failures
 static int *num_failures_h = nullptr;
@@ -141,6 +143,99 @@ static int *num_failures_d = nullptr;
 
 static bool initialized = false;
 
+namespace quda
+{
+
+  /**
+     Dirac operators built by the operator application and solver
+     entry points are kept between calls, keyed on the DiracParam they
+     were built from and the role they play in the solver, so that a
+     host application that applies or inverts the same operator many
+     times per trajectory no longer constructs it on every call.  An
+     operator may hold state derived from the fields it was built on,
+     and a field freed and reallocated may reappear at the same
+     address, so the cache must be flushed wherever the resident gauge
+     or clover fields are loaded, replaced, modified or freed.
+  */
+  class DiracCache
+  {
+  public:
+    /**
+       The operators of a solver are distinct objects even when their
+       parameters coincide, since the solvers may treat them
+       independently.
+    */
+    enum Role { PRECISE, SLOPPY, PRECONDITIONER, EIGENSOLVER };
+
+  private:
+    struct Entry {
+      DiracParam param;
+      Role role;
+      Dirac *dirac;
+    };
+
+    static constexpr size_t max_size = 16;
+    std::list<Entry> cache; // most recently used first
+
+    static bool equal(const DiracParam &a, const DiracParam &b)
+    {
+      if (a.type != b.type || a.kappa != b.kappa || a.mass != b.mass || a.m5 != b.m5 || a.Ls != b.Ls) return false;
+      // the Mobius coefficients are only set for the Mobius operators
+      if (a.type == QUDA_MOBIUS_DOMAIN_WALL_DIRAC || a.type == QUDA_MOBIUS_DOMAIN_WALLPC_DIRAC
+          || a.type == QUDA_MOBIUS_DOMAIN_WALL_EOFA_DIRAC || a.type == QUDA_MOBIUS_DOMAIN_WALLPC_EOFA_DIRAC) {
+        for (int i = 0; i < a.Ls && i < QUDA_MAX_DWF_LS; i++)
+          if (a.b_5[i] != b.b_5[i] || a.c_5[i] != b.c_5[i]) return false;
+      }
+      if (a.eofa_shift != b.eofa_shift || a.eofa_pm != b.eofa_pm || a.mq1 != b.mq1 || a.mq2 != b.mq2 || a.mq3 != b.mq3)
+        return false;
+      if (a.matpcType != b.matpcType || a.dagger != b.dagger || a.laplace3D != b.laplace3D) return false;
+      if (a.gauge != b.gauge || a.fatGauge != b.fatGauge || a.longGauge != b.longGauge || a.clover != b.clover
+          || a.xInvKD != b.xInvKD || a.gauge_h != b.gauge_h || a.clover_h != b.clover_h)
+        return false;
+      if (a.mu != b.mu || a.mu_factor != b.mu_factor || a.epsilon != b.epsilon) return false;
+      if (a.tmp1 != b.tmp1 || a.tmp2 != b.tmp2 || a.halo_precision != b.halo_precision) return false;
+      if (a.transfer != b.transfer || a.dirac != b.dirac || a.need_bidirectional != b.need_bidirectional
+          || a.use_mma != b.use_mma)
+        return false;
+      for (int i = 0; i < QUDA_MAX_DIM; i++)
+        if (a.commDim[i] != b.commDim[i]) return false;
+      return true;
+    }
+
+  public:
+    /**
+       @brief Return the operator for param, creating it if it is not
+       cached.  The operator is owned by the cache.
+       @param[in] param The operator parameters
+       @param[in] role The role of the operator in the solver
+    */
+    Dirac *get(const DiracParam &param, Role role = PRECISE)
+    {
+      for (auto it = cache.begin(); it != cache.end(); it++) {
+        if (it->role == role && equal(it->param, param)) {
+          cache.splice(cache.begin(), cache, it);
+          return it->dirac;
+        }
+      }
+      if (cache.size() == max_size) {
+        delete cache.back().dirac;
+        cache.pop_back();
+      }
+      cache.push_front({param, role, Dirac::create(param)});
+      return cache.front().dirac;
+    }
+
+    void flush()
+    {
+      for (auto &entry : cache) delete entry.dirac;
+      cache.clear();
+    }
+  };
+
+  static DiracCache diracCache;
+
+} // namespace quda
+
 //!< Profiler for initQuda
 static TimeProfile profileInit("initQuda");
 
@@ -568,6 +663,8 @@ static bool invalidate_clover = true;
 
 void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
 {
+  diracCache.flush();
+
   profileGauge.TPSTART(QUDA_PROFILE_TOTAL);
 
   if (!initialized) errorQuda("QUDA not initialized");
@@ -873,6 +970,8 @@ void freeSloppyCloverQuda();
 
 void loadCloverQuda(void *h_clover, void *h_clovinv, QudaInvertParam *inv_param)
 {
+  diracCache.flush();
+
   profileClover.TPSTART(QUDA_PROFILE_TOTAL);
   profileClover.TPSTART(QUDA_PROFILE_INIT);
 
@@ -1065,6 +1164,8 @@ void freeSloppyCloverQuda();
 
 void loadSloppyCloverQuda(const QudaPrecision *prec)
 {
+  diracCache.flush();
+
   freeSloppyCloverQuda();
 
   if (cloverPrecise) {
@@ -1131,6 +1232,8 @@ void loadSloppyCloverQuda(const QudaPrecision *prec)
 // just free the sloppy fields used in mixed-precision solvers
 void freeSloppyGaugeQuda()
 {
+  diracCache.flush();
+
   if (!initialized) errorQuda("QUDA not initialized");
 
   // Wilson gauges
@@ -1205,6 +1308,7 @@ void freeGaugeQuda(void)
 {
   if (!initialized) errorQuda("QUDA not initialized");
 
+  diracCache.flush();
   freeSloppyGaugeQuda();
 
   if (gaugePrecise) delete gaugePrecise;
@@ -1236,6 +1340,8 @@ void freeGaugeQuda(void)
 
 void loadSloppyGaugeQuda(const QudaPrecision *prec, const QudaReconstructType *recon)
 {
+  diracCache.flush();
+
   // first do SU3 links (if they exist)
   if (gaugePrecise) {
     GaugeFieldParam gauge_param(*gaugePrecise);
@@ -1442,6 +1548,7 @@ void loadSloppyGaugeQuda(const QudaPrecision *prec, const QudaReconstructType *r
 void freeSloppyCloverQuda()
 {
   if (!initialized) errorQuda("QUDA not initialized");
+  diracCache.flush();
 
   // Delete cloverRefinement if it does not alias gaugeSloppy.
   if (cloverRefinement != cloverSloppy && cloverRefinement) delete cloverRefinement;
@@ -1467,6 +1574,7 @@ void freeSloppyCloverQuda()
 void freeCloverQuda(void)
 {
   if (!initialized) errorQuda("QUDA not initialized");
+  diracCache.flush();
   freeSloppyCloverQuda();
   if (cloverPrecise) delete cloverPrecise;
   cloverPrecise = nullptr;
@@ -1477,12 +1585,8 @@ void flushChronoQuda(int i)
   if (i >= QUDA_MAX_CHRONO)
     errorQuda("Requested chrono index %d is outside of max %d\n", i, QUDA_MAX_CHRONO);
 
-  auto &basis = chronoResident[i];
-
-  for (auto v : basis) {
-    if (v)  delete v;
-  }
-  basis.clear();
+  if (chronoResident[i]) delete chronoResident[i];
+  chronoResident[i] = nullptr;
 }
 
 void endQuda(void)
@@ -1850,10 +1954,11 @@ namespace quda {
     setDiracPreParam(diracPreParam, &param, pc_solve, comms_flag);
     setDiracEigParam(diracEigParam, &param, pc_solve, comms_flag);
 
-    d = Dirac::create(diracParam); // create the Dirac operator
-    dSloppy = Dirac::create(diracSloppyParam);
-    dPre = Dirac::create(diracPreParam);
-    dEig = Dirac::create(diracEigParam);
+    // these operators are owned by the cache
+    d = diracCache.get(diracParam, DiracCache::PRECISE);
+    dSloppy = diracCache.get(diracSloppyParam, DiracCache::SLOPPY);
+    dPre = diracCache.get(diracPreParam, DiracCache::PRECONDITIONER);
+    dEig = diracCache.get(diracEigParam, DiracCache::EIGENSOLVER);
   }
 
   static double unscaled_shifts[QUDA_MAX_MULTI_SHIFT];
@@ -2003,7 +2108,7 @@ void dslashQuda(void *h_out, void *h_in, QudaInvertParam *inv_param, QudaParity
     blas::ax(gauge.Anisotropy(), in);
   }
 
-  Dirac *dirac = Dirac::create(diracParam); // create the Dirac operator
+  Dirac *dirac = diracCache.get(diracParam); // get the Dirac operator
   if (inv_param->dslash_type == QUDA_TWISTED_CLOVER_DSLASH && inv_param->dagger) {
     cudaParam.create = QUDA_NULL_FIELD_CREATE;
     cudaColorSpinorField tmp1(in, cudaParam);
@@ -2025,8 +2130,6 @@ void dslashQuda(void *h_out, void *h_in, QudaInvertParam *inv_param, QudaParity
   }
 
   profileDslash.TPSTART(QUDA_PROFILE_FREE);
-  delete dirac; // clean up
-
   delete out_h;
   delete in_h;
   profileDslash.TPSTOP(QUDA_PROFILE_FREE);
@@ -2069,9 +2172,8 @@ void MatQuda(void *h_out, void *h_in, QudaInvertParam *inv_param)
   DiracParam diracParam;
   setDiracParam(diracParam, inv_param, pc);
 
-  Dirac *dirac = Dirac::create(diracParam); // create the Dirac operator
+  Dirac *dirac = diracCache.get(diracParam); // get the Dirac operator
   dirac->M(out, in); // apply the operator
-  delete dirac; // clean up
 
   double kappa = inv_param->kappa;
   if (pc) {
@@ -2142,9 +2244,8 @@ void MatDagMatQuda(void *h_out, void *h_in, QudaInvertParam *inv_param)
   DiracParam diracParam;
   setDiracParam(diracParam, inv_param, pc);
 
-  Dirac *dirac = Dirac::create(diracParam); // create the Dirac operator
+  Dirac *dirac = diracCache.get(diracParam); // get the Dirac operator
   dirac->MdagM(out, in); // apply the operator
-  delete dirac; // clean up
 
   double kappa = inv_param->kappa;
   if (pc) {
@@ -3045,41 +3146,15 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     DiracM m(dirac), mSloppy(diracSloppy), mPre(diracPre), mEig(diracEig);
     SolverParam solverParam(*param);
     // chronological forecasting
-    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
+    if (param->chrono_use_resident && chronoResident[param->chrono_index]) {
       profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
 
-      auto &basis = chronoResident[param->chrono_index];
-
-      ColorSpinorParam cs_param(*basis[0]);
-      ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
-      ColorSpinorField *tmp2 = (param->chrono_precision == out->Precision()) ? out : ColorSpinorField::Create(cs_param);
-      std::vector<ColorSpinorField*> Ap;
-      for (unsigned int k=0; k < basis.size(); k++) {
-        Ap.emplace_back((ColorSpinorField::Create(cs_param)));
-      }
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j=0; j<basis.size(); j++) m(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j=0; j<basis.size(); j++) mSloppy(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
-      }
-
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = false;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-
-      blas::copy(*tmp, *in);
-      mre(*out, *tmp, basis, Ap);
-
-      for (auto ap: Ap) {
-        if (ap) delete (ap);
-      }
-      delete tmp;
-      if (tmp2 != out) delete tmp2;
+      auto &chrono = *chronoResident[param->chrono_index];
+      // expand the basis to the sloppy precision if it is stored at or below it
+      if (chrono.Precision() <= param->cuda_prec_sloppy)
+        chrono(*out, *in, mSloppy, param->cuda_prec_sloppy, false, profileInvert);
+      else
+        chrono(*out, *in, m, param->cuda_prec, false, profileInvert);
 
       profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
     }
@@ -3093,41 +3168,15 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     SolverParam solverParam(*param);
 
     // chronological forecasting
-    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
+    if (param->chrono_use_resident && chronoResident[param->chrono_index]) {
       profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
 
-      auto &basis = chronoResident[param->chrono_index];
-
-      ColorSpinorParam cs_param(*basis[0]);
-      std::vector<ColorSpinorField*> Ap;
-      ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
-      ColorSpinorField *tmp2 = (param->chrono_precision == out->Precision()) ? out : ColorSpinorField::Create(cs_param);
-      for (unsigned int k=0; k < basis.size(); k++) {
-        Ap.emplace_back((ColorSpinorField::Create(cs_param)));
-      }
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j=0; j<basis.size(); j++) m(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j=0; j<basis.size(); j++) mSloppy(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
-      }
-
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = true;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-
-      blas::copy(*tmp, *in);
-      mre(*out, *tmp, basis, Ap);
-
-      for (auto ap: Ap) {
-        if (ap) delete(ap);
-      }
-      delete tmp;
-      if (tmp2 != out) delete tmp2;
+      auto &chrono = *chronoResident[param->chrono_index];
+      // expand the basis to the sloppy precision if it is stored at or below it
+      if (chrono.Precision() <= param->cuda_prec_sloppy)
+        chrono(*out, *in, mSloppy, param->cuda_prec_sloppy, true, profileInvert);
+      else
+        chrono(*out, *in, m, param->cuda_prec, true, profileInvert);
 
       profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
     }
@@ -3171,26 +3220,19 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     if (i >= QUDA_MAX_CHRONO)
       errorQuda("Requested chrono index %d is outside of max %d\n", i, QUDA_MAX_CHRONO);
 
-    auto &basis = chronoResident[i];
+    if (!chronoResident[i])
+      chronoResident[i] = new ChronoForecast(*out, param->chrono_max_dim, param->chrono_precision,
+                                             param->chrono_max_device_dim,
+                                             param->chrono_spill_pinned == QUDA_BOOLEAN_TRUE);
+    auto &chrono = *chronoResident[i];
 
-    if(param->chrono_max_dim < (int)basis.size()){
-      errorQuda("Requested chrono_max_dim %i is smaller than already existing chroology %i",param->chrono_max_dim,(int)basis.size());
+    if (param->chrono_max_dim < chrono.size()) {
+      errorQuda("Requested chrono_max_dim %i is smaller than already existing chroology %i", param->chrono_max_dim,
+                chrono.size());
     }
+    chrono.MaxDim(param->chrono_max_dim);
 
-    if(not param->chrono_replace_last){
-      // if we have not filled the space yet just augment
-      if ((int)basis.size() < param->chrono_max_dim) {
-        ColorSpinorParam cs_param(*out);
-        cs_param.setPrecision(param->chrono_precision);
-        basis.emplace_back(ColorSpinorField::Create(cs_param));
-      }
-
-      // shuffle every entry down one and bring the last to the front
-      ColorSpinorField *tmp = basis[basis.size()-1];
-      for (unsigned int j=basis.size()-1; j>0; j--) basis[j] = basis[j-1];
-        basis[0] = tmp;
-    }
-    *(basis[0]) = *out; // set first entry to new solution
+    chrono.push(*out, param->chrono_replace_last);
   }
   dirac.reconstruct(*x, *b, param->solution_type);
 
@@ -3234,11 +3276,6 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     delete x;
   }
 
-  delete d;
-  delete dSloppy;
-  delete dPre;
-  delete dEig;
-
   profileInvert.TPSTOP(QUDA_PROFILE_FREE);
 
   popVerbosity();
@@ -4194,6 +4231,7 @@ int computeGaugeForceQuda(void* mom, void* siteLink,  int*** input_path_buf, int
 
   profileGaugeForce.TPSTART(QUDA_PROFILE_FREE);
   if (qudaGaugeParam->make_resident_gauge) {
+    diracCache.flush();
     if (gaugePrecise && gaugePrecise != cudaSiteLink) delete gaugePrecise;
     gaugePrecise = cudaSiteLink;
   } else {
@@ -4284,6 +4322,7 @@ void momResidentQuda(void *mom, QudaGaugeParam *param)
 void createCloverQuda(QudaInvertParam* invertParam)
 {
   profileClover.TPSTART(QUDA_PROFILE_TOTAL);
+  diracCache.flush();
   if (!cloverPrecise) errorQuda("Clover field not allocated");
 
   QudaReconstructType recon = (gaugePrecise->Reconstruct() == QUDA_RECONSTRUCT_8) ? QUDA_RECONSTRUCT_12 : gaugePrecise->Reconstruct();
@@ -4955,6 +4994,7 @@ void updateGaugeFieldQuda(void* gauge,
 			  QudaGaugeParam* param)
 {
   profileGaugeUpdate.TPSTART(QUDA_PROFILE_TOTAL);
+  diracCache.flush();
 
   checkGaugeParam(param);
 
@@ -5053,6 +5093,9 @@ void updateGaugeFieldQuda(void* gauge,
    profileProject.TPSTART(QUDA_PROFILE_INIT);
    checkGaugeParam(param);
 
+   // the resident field is modified in place or replaced, so cached operators are stale
+   if (param->use_resident_gauge || param->make_resident_gauge) diracCache.flush();
+
    // create the gauge field
    GaugeFieldParam gParam(gauge_h, *param, QUDA_GENERAL_LINKS);
    gParam.site_offset = param->gauge_offset;
@@ -5114,6 +5157,9 @@ void updateGaugeFieldQuda(void* gauge,
    profilePhase.TPSTART(QUDA_PROFILE_INIT);
    checkGaugeParam(param);
 
+   // the resident field is modified in place or replaced, so cached operators are stale
+   if (param->use_resident_gauge || param->make_resident_gauge) diracCache.flush();
+
    // create the gauge field
    GaugeFieldParam gParam(gauge_h, *param, QUDA_GENERAL_LINKS);
    bool need_cpu = !param->use_resident_gauge || param->return_result_gauge;
@@ -5410,6 +5456,7 @@ void compute_staggered_force_quda_(void* h_mom, double *dt, double *delta, void
 void apply_staggered_phase_quda_() {
   if (getVerbosity() >= QUDA_VERBOSE) printfQuda("applying staggered phase\n");
   if (gaugePrecise) {
+    diracCache.flush();
     gaugePrecise->applyStaggeredPhase();
   } else {
     errorQuda("No persistent gauge field");
@@ -5420,6 +5467,7 @@ void apply_staggered_phase_quda_() {
 void remove_staggered_phase_quda_() {
   if (getVerbosity() >= QUDA_VERBOSE) printfQuda("removing staggered phase\n");
   if (gaugePrecise) {
+    diracCache.flush();
     gaugePrecise->removeStaggeredPhase();
   } else {
     errorQuda("No persistent gauge field");
@@ -5772,6 +5820,7 @@ int computeGaugeFixingOVRQuda(void *gauge, const unsigned int gauge_dir, const u
                               double *timeinfo)
 {
   GaugeFixOVRQuda.TPSTART(QUDA_PROFILE_TOTAL);
+  diracCache.flush();
 
   checkGaugeParam(param);
 
@@ -5846,6 +5895,7 @@ int computeGaugeFixingFFTQuda(void* gauge, const unsigned int gauge_dir,  const
   const unsigned int  stopWtheta, QudaGaugeParam* param , double* timeinfo)
 {
   GaugeFixFFTQuda.TPSTART(QUDA_PROFILE_TOTAL);
+  diracCache.flush();
 
   checkGaugeParam(param);
 
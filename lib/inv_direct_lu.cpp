@@ -0,0 +1,217 @@
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <quda_internal.h>
+#include <color_spinor_field.h>
+#include <blas_quda.h>
+#include <invert_quda.h>
+#include <util_quda.h>
+
+namespace quda {
+
+  // the dense matrix is replicated on every rank, so bound its size
+  // (1 GiB per rank) and warn well before that, since every rank
+  // also redoes the O(n^3) factorization
+  constexpr int direct_lu_max_dim = 8192;
+  constexpr int direct_lu_warn_dim = 2048;
+
+  DirectLU::DirectLU(const DiracMatrix &mat, SolverParam &param, TimeProfile &profile) :
+    Solver(mat, mat, mat, mat, param, profile), n_local(0), n(0), init(false), x_h(nullptr), b_h(nullptr)
+  {
+  }
+
+  DirectLU::~DirectLU()
+  {
+    if (!param.is_preconditioner) profile.TPSTART(QUDA_PROFILE_FREE);
+    if (init) {
+      delete x_h;
+      delete b_h;
+    }
+    if (!param.is_preconditioner) profile.TPSTOP(QUDA_PROFILE_FREE);
+  }
+
+  /**
+     @brief Read or write entry i of a host field in space-spin-color order
+  */
+  template <typename Float> static Complex getEntry(const ColorSpinorField &f, int i)
+  {
+    auto v = static_cast<const Float *>(f.V());
+    return Complex(v[2 * i], v[2 * i + 1]);
+  }
+
+  template <typename Float> static void setEntry(ColorSpinorField &f, int i, const Complex &z)
+  {
+    auto v = static_cast<Float *>(f.V());
+    v[2 * i] = z.real();
+    v[2 * i + 1] = z.imag();
+  }
+
+  static Complex getEntry(const ColorSpinorField &f, int i)
+  {
+    return f.Precision() == QUDA_DOUBLE_PRECISION ? getEntry<double>(f, i) : getEntry<float>(f, i);
+  }
+
+  static void setEntry(ColorSpinorField &f, int i, const Complex &z)
+  {
+    if (f.Precision() == QUDA_DOUBLE_PRECISION)
+      setEntry<double>(f, i, z);
+    else
+      setEntry<float>(f, i, z);
+  }
+
+  void DirectLU::create(const ColorSpinorField &b)
+  {
+    ColorSpinorParam csParam(b);
+    csParam.create = QUDA_ZERO_FIELD_CREATE;
+    csParam.location = QUDA_CPU_FIELD_LOCATION;
+    csParam.pad = 0;
+    csParam.setPrecision(b.Precision() == QUDA_DOUBLE_PRECISION ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION);
+    csParam.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+    x_h = ColorSpinorField::Create(csParam);
+    b_h = ColorSpinorField::Create(csParam);
+
+    n_local = b.Volume() * b.Nspin() * b.Ncolor();
+    n = n_local * comm_size();
+    if (n > direct_lu_max_dim)
+      errorQuda("Operator dimension %d exceeds maximum %d for the direct solver", n, direct_lu_max_dim);
+    if (n > direct_lu_warn_dim)
+      warningQuda("Direct solver of dimension %d needs %.2f GiB and O(n^3) factorization on each of %d ranks", n,
+                  n * (double)n * sizeof(Complex) / (1024.0 * 1024.0 * 1024.0), comm_size());
+#ifndef _OPENMP
+    warningQuda("Direct solver factorization is serial since QUDA was built without OpenMP (QUDA_OPENMP=OFF)");
+#endif
+    init = true;
+  }
+
+  /*
+    Assemble the dense matrix column by column: every rank takes part
+    in applying the operator to the unit vector of global index j,
+    which is nonzero only on its owning rank, and keeps the rows of
+    its own sites.  Rank r owns rows r * n_local to (r + 1) * n_local,
+    so summing over ranks gives the full matrix on every rank.
+  */
+  void DirectLU::assemble(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("DirectLU: assembling operator of dimension %d (%.2f GiB per rank)\n", n,
+                 n * (double)n * sizeof(Complex) / (1024.0 * 1024.0 * 1024.0));
+
+    A.assign((size_t)n * n, 0.0);
+    const int offset = comm_rank() * n_local;
+
+    for (int j = 0; j < n; j++) {
+      const int owner = j / n_local;
+      memset(b_h->V(), 0, b_h->Bytes());
+      if (owner == comm_rank()) setEntry(*b_h, j % n_local, 1.0);
+      b = *b_h;
+      mat(x, b);
+      *x_h = x;
+      for (int i = 0; i < n_local; i++) A[(size_t)(offset + i) * n + j] = getEntry(*x_h, i);
+    }
+
+    if (comm_size() > 1) comm_allreduce_array(reinterpret_cast<double *>(A.data()), 2 * (size_t)n * n);
+  }
+
+  /*
+    Right-looking LU factorization with partial pivoting, in place.
+    The rank-one update of the trailing matrix is threaded over rows
+    when built with OpenMP.
+  */
+  void DirectLU::factorize()
+  {
+    pivot.resize(n);
+    for (int k = 0; k < n; k++) {
+      Complex *Ak = A.data() + (size_t)k * n;
+
+      int p = k;
+      double max = std::abs(Ak[k]);
+      for (int i = k + 1; i < n; i++) {
+        double a = std::abs(A[(size_t)i * n + k]);
+        if (a > max) {
+          max = a;
+          p = i;
+        }
+      }
+      if (max == 0.0) errorQuda("Singular operator in direct solver at column %d", k);
+      pivot[k] = p;
+      if (p != k) std::swap_ranges(Ak, Ak + n, A.data() + (size_t)p * n);
+
+      const Complex inv = 1.0 / Ak[k];
+#pragma omp parallel for schedule(static)
+      for (int i = k + 1; i < n; i++) {
+        Complex *Ai = A.data() + (size_t)i * n;
+        const Complex l = Ai[k] * inv;
+        Ai[k] = l;
+        for (int j = k + 1; j < n; j++) Ai[j] -= l * Ak[j];
+      }
+    }
+  }
+
+  void DirectLU::operator()(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    if (!init) {
+      if (!param.is_preconditioner) profile.TPSTART(QUDA_PROFILE_INIT);
+      create(b);
+      if (!param.is_preconditioner) profile.TPSTOP(QUDA_PROFILE_INIT);
+    }
+
+    if (A.size() == 0) {
+      // assembly overwrites b, so keep a copy of the source
+      *b_h = b;
+      std::vector<Complex> source(n_local);
+      for (int i = 0; i < n_local; i++) source[i] = getEntry(*b_h, i);
+
+      if (!param.is_preconditioner) profile.TPSTART(QUDA_PROFILE_PREAMBLE);
+      assemble(x, b);
+      if (!param.is_preconditioner) profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
+
+      if (!param.is_preconditioner) profile.TPSTART(QUDA_PROFILE_HOST_COMPUTE);
+      factorize();
+      if (!param.is_preconditioner) profile.TPSTOP(QUDA_PROFILE_HOST_COMPUTE);
+
+      for (int i = 0; i < n_local; i++) setEntry(*b_h, i, source[i]);
+      b = *b_h;
+    }
+
+    if (!param.is_preconditioner) profile.TPSTART(QUDA_PROFILE_HOST_COMPUTE);
+
+    // gather the source onto every rank
+    const int offset = comm_rank() * n_local;
+    *b_h = b;
+    std::vector<Complex> y(n, 0.0);
+    for (int i = 0; i < n_local; i++) y[offset + i] = getEntry(*b_h, i);
+    if (comm_size() > 1) comm_allreduce_array(reinterpret_cast<double *>(y.data()), 2 * (size_t)n);
+
+    // apply the row interchanges, then forward and backward substitution
+    for (int k = 0; k < n; k++)
+      if (pivot[k] != k) std::swap(y[k], y[pivot[k]]);
+    for (int i = 1; i < n; i++) {
+      const Complex *Ai = A.data() + (size_t)i * n;
+      Complex sum = y[i];
+      for (int j = 0; j < i; j++) sum -= Ai[j] * y[j];
+      y[i] = sum;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+      const Complex *Ai = A.data() + (size_t)i * n;
+      Complex sum = y[i];
+      for (int j = i + 1; j < n; j++) sum -= Ai[j] * y[j];
+      y[i] = sum / Ai[i];
+    }
+
+    for (int i = 0; i < n_local; i++) setEntry(*x_h, i, y[offset + i]);
+    x = *x_h;
+
+    param.gflops += 8e-9 * n * (double)n;
+    if (!param.is_preconditioner) profile.TPSTOP(QUDA_PROFILE_HOST_COMPUTE);
+
+    if (getVerbosity() >= QUDA_DEBUG_VERBOSE) {
+      ColorSpinorField *r = ColorSpinorField::Create(ColorSpinorParam(b));
+      mat(*r, x);
+      double r2 = blas::xmyNorm(b, *r);
+      printfQuda("DirectLU: dimension = %d, |res| / |src| = %e\n", n, sqrt(r2 / blas::norm2(b)));
+      delete r;
+    }
+  }
+
+} // namespace quda
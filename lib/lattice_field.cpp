@@ -1,4 +1,10 @@
 #include <typeinfo>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
 #include <quda_internal.h>
 #include <lattice_field.h>
 #include <color_spinor_field.h>
@@ -236,6 +242,10 @@ namespace quda {
           qudaDeviceSynchronize();
           comm_barrier();
           for (int b=0; b<2; b++) {
+            comm_handle_cache_invalidate(ghost_recv_buffer_d[b]);
+            comm_handle_cache_invalidate(ghost_send_buffer_d[b]);
+            comm_handle_cache_invalidate(ghost_pinned_send_buffer_h[b]);
+            comm_handle_cache_invalidate(ghost_pinned_recv_buffer_h[b]);
 	    device_pinned_free(ghost_recv_buffer_d[b]);
 	    device_pinned_free(ghost_send_buffer_d[b]);
 	    host_free(ghost_pinned_send_buffer_h[b]);
@@ -263,6 +273,12 @@ namespace quda {
 
 	  // set the matching device-mapped pointer
 	  ghost_pinned_recv_buffer_hd[b] = get_mapped_device_pointer(ghost_pinned_recv_buffer_h[b]);
+
+          // message handles to these buffers persist until the buffers are reallocated
+          comm_handle_cache_register(ghost_recv_buffer_d[b], ghost_bytes);
+          comm_handle_cache_register(ghost_send_buffer_d[b], ghost_bytes);
+          comm_handle_cache_register(ghost_pinned_send_buffer_h[b], ghost_bytes);
+          comm_handle_cache_register(ghost_pinned_recv_buffer_h[b], ghost_bytes);
         }
 
         initGhostFaceBuffer = true;
@@ -281,6 +297,11 @@ namespace quda {
     if (!initGhostFaceBuffer) return;
 
     for (int b=0; b<2; b++) {
+      comm_handle_cache_invalidate(ghost_recv_buffer_d[b]);
+      comm_handle_cache_invalidate(ghost_send_buffer_d[b]);
+      comm_handle_cache_invalidate(ghost_pinned_recv_buffer_h[b]);
+      comm_handle_cache_invalidate(ghost_pinned_send_buffer_h[b]);
+
       // free receive buffer
       if (ghost_recv_buffer_d[b]) device_pinned_free(ghost_recv_buffer_d[b]);
       ghost_recv_buffer_d[b] = nullptr;
@@ -673,12 +694,274 @@ namespace quda {
     return location;
   }
 
-  void LatticeField::read(char *filename) {
-    errorQuda("Not implemented");
+  namespace {
+
+    /**
+       Header of the native binary field format.  The header is
+       followed by a table of per-rank checksums, and then by the raw
+       local field data of each rank at offset data_offset + rank *
+       rank_bytes.  The data are stored in the native memory layout of
+       the field, so a file can only be read back into a field with
+       the same precision, order, local volume and process grid.
+    */
+    struct NativeFieldHeader {
+      char magic[8];
+      int32_t version;
+      int32_t kind;      // 0 = color-spinor field, 1 = gauge field, 2 = clover field
+      int32_t nDim;
+      int32_t x[QUDA_MAX_DIM];    // local dimensions
+      int32_t grid[QUDA_MAX_DIM]; // process grid
+      int32_t n_rank;
+      int32_t precision;
+      int32_t order;
+      int32_t site_subset;
+      int32_t n_color;
+      int32_t n_spin;      // color-spinor fields only
+      int32_t geometry;    // gauge fields only
+      int32_t reconstruct; // gauge fields only
+      int32_t inverse;     // clover fields only: whether the inverse is stored
+      int32_t n_segment;
+      uint64_t rank_bytes;
+      uint64_t data_offset;
+    };
+
+    constexpr char native_field_magic[8] = {'Q', 'U', 'D', 'A', 'F', 'L', 'D', '\0'};
+    constexpr int native_field_version = 2;
+    constexpr uint64_t native_field_align = 4096;
+    constexpr int max_segment = 2 * QUDA_MAX_DIM;
+
+    /**
+       A contiguous block of field memory to be read or written
+    */
+    struct FieldSegment {
+      void *ptr;
+      size_t bytes;
+    };
+
+    /**
+       @brief Fill in the header metadata for a field, and return the
+       list of contiguous memory segments that hold its data.
+    */
+    std::vector<FieldSegment> native_field_layout(const LatticeField &field, NativeFieldHeader &h)
+    {
+      std::vector<FieldSegment> segment;
+
+      memset(&h, 0, sizeof(h));
+      memcpy(h.magic, native_field_magic, sizeof(h.magic));
+      h.version = native_field_version;
+      h.nDim = field.Ndim();
+      for (int d = 0; d < field.Ndim(); d++) {
+        h.x[d] = field.X()[d];
+        h.grid[d] = comm_dim(d);
+      }
+      h.n_rank = comm_size();
+      h.precision = field.Precision();
+      h.site_subset = field.SiteSubset();
+
+      if (auto csf = dynamic_cast<const ColorSpinorField *>(&field)) {
+        h.kind = 0;
+        h.order = csf->FieldOrder();
+        h.n_color = csf->Ncolor();
+        h.n_spin = csf->Nspin();
+        segment.push_back({const_cast<void *>(csf->V()), csf->Bytes()});
+        if (csf->NormBytes()) segment.push_back({const_cast<void *>(csf->Norm()), csf->NormBytes()});
+      } else if (auto gauge = dynamic_cast<const GaugeField *>(&field)) {
+        h.kind = 1;
+        h.order = gauge->Order();
+        h.n_color = gauge->Ncolor();
+        h.geometry = gauge->Geometry();
+        h.reconstruct = gauge->Reconstruct();
+        if (gauge->Order() == QUDA_QDP_GAUGE_ORDER) {
+          // each link direction is a separate allocation
+          void **links = static_cast<void **>(const_cast<void *>(gauge->Gauge_p()));
+          for (int d = 0; d < gauge->Geometry(); d++) segment.push_back({links[d], gauge->Bytes() / gauge->Geometry()});
+        } else {
+          segment.push_back({const_cast<void *>(gauge->Gauge_p()), gauge->Bytes()});
+        }
+      } else if (auto clover = dynamic_cast<const CloverField *>(&field)) {
+        h.kind = 2;
+        h.order = clover->Order();
+        h.n_color = 3;
+        h.inverse = clover->V(true) && clover->V(true) != clover->V(false);
+        for (int inverse = 0; inverse <= h.inverse; inverse++) {
+          segment.push_back({const_cast<void *>(clover->V(inverse)), clover->Bytes()});
+          if (clover->NormBytes()) segment.push_back({const_cast<void *>(clover->Norm(inverse)), clover->NormBytes()});
+        }
+      } else {
+        errorQuda("Unknown field %s, so cannot determine native layout", typeid(field).name());
+      }
+
+      if (segment.size() > max_segment) errorQuda("Number of segments %lu exceeds maximum %d", segment.size(), max_segment);
+      h.n_segment = segment.size();
+      for (auto &s : segment) h.rank_bytes += s.bytes;
+      size_t table_end = sizeof(NativeFieldHeader) + h.n_rank * sizeof(uint64_t);
+      h.data_offset = ((table_end + native_field_align - 1) / native_field_align) * native_field_align;
+
+      return segment;
+    }
+
+    /**
+       @return The number of 64-bit words a segment of the given size
+       occupies in the checksum, its trailing bytes padded to a word
+    */
+    size_t native_field_words(size_t bytes) { return (bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t); }
+
+    /**
+       @brief Position-dependent 64-bit checksum of a buffer, updated
+       incrementally so a rank's data can be checksummed segment by
+       segment.  Each segment starts on a word of its own, with any
+       trailing bytes zero padded to a whole word, so every word has a
+       distinct weight however the segment lengths divide.
+       @param[in] sum Running checksum
+       @param[in] buf Buffer we are adding to the checksum
+       @param[in] bytes Size of the buffer
+       @param[in] word_offset Index of the first word of buf in the
+       checksum, the sum of native_field_words of the preceding segments
+    */
+    uint64_t native_field_checksum(uint64_t sum, const char *buf, size_t bytes, size_t word_offset)
+    {
+      const size_t n_word = bytes / sizeof(uint64_t);
+      uint64_t local = 0;
+#pragma omp parallel for reduction(+ : local)
+      for (size_t i = 0; i < n_word; i++) {
+        uint64_t w;
+        memcpy(&w, buf + i * sizeof(uint64_t), sizeof(uint64_t));
+        local += w * (2 * (word_offset + i) + 1);
+      }
+      if (bytes > n_word * sizeof(uint64_t)) {
+        uint64_t w = 0;
+        memcpy(&w, buf + n_word * sizeof(uint64_t), bytes - n_word * sizeof(uint64_t));
+        local += w * (2 * (word_offset + n_word) + 1);
+      }
+      return sum + local;
+    }
+
+    void native_field_pwrite(int fd, const char *buf, size_t bytes, off_t offset, const char *filename)
+    {
+      while (bytes > 0) {
+        ssize_t n = pwrite(fd, buf, bytes, offset);
+        if (n < 0) {
+          if (errno == EINTR) continue;
+          errorQuda("Failed to write to %s (%s)", filename, strerror(errno));
+        }
+        buf += n;
+        bytes -= n;
+        offset += n;
+      }
+    }
+
+    void native_field_pread(int fd, char *buf, size_t bytes, off_t offset, const char *filename)
+    {
+      while (bytes > 0) {
+        ssize_t n = pread(fd, buf, bytes, offset);
+        if (n < 0) {
+          if (errno == EINTR) continue;
+          errorQuda("Failed to read from %s (%s)", filename, strerror(errno));
+        }
+        if (n == 0) errorQuda("Unexpected end of file reading %s", filename);
+        buf += n;
+        bytes -= n;
+        offset += n;
+      }
+    }
+
+  } // namespace
+
+  void LatticeField::write(char *filename)
+  {
+    NativeFieldHeader h;
+    auto segment = native_field_layout(*this, h);
+    const bool device = Location() == QUDA_CUDA_FIELD_LOCATION;
+    const int rank = comm_rank();
+
+    // rank 0 creates the file and writes the header so that all other ranks can open it
+    if (rank == 0) {
+      int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (fd < 0) errorQuda("Failed to open %s for writing (%s)", filename, strerror(errno));
+      native_field_pwrite(fd, reinterpret_cast<const char *>(&h), sizeof(h), 0, filename);
+      if (ftruncate(fd, h.data_offset + h.n_rank * h.rank_bytes) != 0)
+        errorQuda("Failed to size %s (%s)", filename, strerror(errno));
+      close(fd);
+    }
+    comm_barrier();
+
+    int fd = open(filename, O_WRONLY);
+    if (fd < 0) errorQuda("Failed to open %s for writing (%s)", filename, strerror(errno));
+
+    size_t max_bytes = 0;
+    for (auto &s : segment) max_bytes = std::max(max_bytes, s.bytes);
+    char *buffer = device ? static_cast<char *>(pinned_malloc(max_bytes)) : nullptr;
+
+    uint64_t checksum = 0;
+    off_t offset = h.data_offset + rank * h.rank_bytes;
+    size_t word_offset = 0;
+    for (auto &s : segment) {
+      const char *src = static_cast<const char *>(s.ptr);
+      if (device) {
+        qudaMemcpy(buffer, s.ptr, s.bytes, cudaMemcpyDeviceToHost);
+        src = buffer;
+      }
+      checksum = native_field_checksum(checksum, src, s.bytes, word_offset);
+      native_field_pwrite(fd, src, s.bytes, offset, filename);
+      offset += s.bytes;
+      word_offset += native_field_words(s.bytes);
+    }
+
+    native_field_pwrite(fd, reinterpret_cast<const char *>(&checksum), sizeof(checksum),
+                        sizeof(h) + rank * sizeof(uint64_t), filename);
+
+    if (buffer) host_free(buffer);
+    close(fd);
+    comm_barrier();
   }
-  
-  void LatticeField::write(char *filename) {
-    errorQuda("Not implemented");
+
+  void LatticeField::read(char *filename)
+  {
+    NativeFieldHeader expected;
+    auto segment = native_field_layout(*this, expected);
+    const bool device = Location() == QUDA_CUDA_FIELD_LOCATION;
+    const int rank = comm_rank();
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) errorQuda("Failed to open %s for reading (%s)", filename, strerror(errno));
+
+    NativeFieldHeader h;
+    native_field_pread(fd, reinterpret_cast<char *>(&h), sizeof(h), 0, filename);
+    if (memcmp(h.magic, native_field_magic, sizeof(h.magic)) != 0)
+      errorQuda("%s is not a native QUDA field file", filename);
+    if (h.version != native_field_version) errorQuda("Unsupported native field version %d", h.version);
+    if (memcmp(&h, &expected, sizeof(h)) != 0)
+      errorQuda("Field in %s (kind = %d, precision = %d, order = %d, subset = %d, rank bytes = %lu) does not match "
+                "destination field (kind = %d, precision = %d, order = %d, subset = %d, rank bytes = %lu)",
+                filename, h.kind, h.precision, h.order, h.site_subset, h.rank_bytes, expected.kind,
+                expected.precision, expected.order, expected.site_subset, expected.rank_bytes);
+
+    uint64_t expected_checksum;
+    native_field_pread(fd, reinterpret_cast<char *>(&expected_checksum), sizeof(expected_checksum),
+                       sizeof(h) + rank * sizeof(uint64_t), filename);
+
+    size_t max_bytes = 0;
+    for (auto &s : segment) max_bytes = std::max(max_bytes, s.bytes);
+    char *buffer = device ? static_cast<char *>(pinned_malloc(max_bytes)) : nullptr;
+
+    uint64_t checksum = 0;
+    off_t offset = h.data_offset + rank * h.rank_bytes;
+    size_t word_offset = 0;
+    for (auto &s : segment) {
+      char *dst = device ? buffer : static_cast<char *>(s.ptr);
+      native_field_pread(fd, dst, s.bytes, offset, filename);
+      checksum = native_field_checksum(checksum, dst, s.bytes, word_offset);
+      if (device) qudaMemcpy(s.ptr, buffer, s.bytes, cudaMemcpyHostToDevice);
+      offset += s.bytes;
+      word_offset += native_field_words(s.bytes);
+    }
+
+    if (buffer) host_free(buffer);
+    close(fd);
+
+    if (checksum != expected_checksum)
+      errorQuda("Checksum mismatch reading %s on rank %d: computed %lx, expected %lx", filename, rank, checksum,
+                expected_checksum);
   }
 
   int LatticeField::Nvec() const {
@@ -1,5 +1,6 @@
 #include <cstdio>
 #include <cstdlib>
+#include <cstdint>
 #include <iostream>
 #include <quda.h>
 #include <quda_milc_interface.h>
@@ -230,14 +231,141 @@ static QudaGaugeParam newMILCGaugeParam(const int* dim, QudaPrecision prec, Quda
   return gParam;
 }
 
+/**
+   Fingerprint of a MILC link buffer that has been uploaded to QUDA.
+   When MILC builds the links itself (create_quda_gauge is false) it
+   passes the same site-major buffers to every solve of a trajectory,
+   so we keep the links resident and only reorder and upload them
+   again when the buffer, its parameters or its contents change.
+*/
+struct MILCLinkFingerprint {
+  const void *links = nullptr;
+  uint64_t checksum = 0;
+  QudaGaugeParam param;
+};
+
+static MILCLinkFingerprint resident_fat_link;
+static MILCLinkFingerprint resident_long_link;
+
 static  void invalidateGaugeQuda() {
   qudamilc_called<true>(__func__);
   freeGaugeQuda();
   invalidate_quda_gauge = true;
   have_resident_gauge = false;
+  resident_fat_link = MILCLinkFingerprint();
+  resident_long_link = MILCLinkFingerprint();
   qudamilc_called<false>(__func__);
 }
 
+// keep MILC-created links resident between solves only if QUDA_MILC_CACHE_LINKS=1
+static bool cacheMILCLinks()
+{
+  static bool cache_queried = false;
+  static bool cache_links = false;
+  if (!cache_queried) {
+    char *cache_env = getenv("QUDA_MILC_CACHE_LINKS");
+    if (cache_env && strcmp(cache_env, "1") == 0) {
+      cache_links = true;
+      printfQuda("Enabling caching of MILC links between solves\n");
+    }
+    cache_queried = true;
+  }
+  return cache_links;
+}
+
+/**
+   Position-dependent checksum of a host link buffer: each 64-bit word
+   is mixed with its index (the splitmix64 finalizer) so that permuted
+   links give a different sum, and the sum lets the sweep be threaded.
+*/
+static uint64_t milcLinkChecksum(const void *links, const QudaGaugeParam &param)
+{
+  const size_t bytes = 4ul * localDim[0] * localDim[1] * localDim[2] * localDim[3] * 18 * param.cpu_prec;
+  const long n_word = bytes / sizeof(uint64_t);
+  const char *data = static_cast<const char *>(links);
+  uint64_t sum = 0;
+#pragma omp parallel for reduction(+ : sum) schedule(static)
+  for (long i = 0; i < n_word; i++) {
+    uint64_t z;
+    memcpy(&z, data + i * sizeof(uint64_t), sizeof(uint64_t));
+    z += 0x9e3779b97f4a7c15ull * (i + 1);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    sum += z ^ (z >> 31);
+  }
+  return sum;
+}
+
+static bool sameLinkParam(const QudaGaugeParam &a, const QudaGaugeParam &b)
+{
+  for (int dir = 0; dir < 4; ++dir)
+    if (a.X[dir] != b.X[dir]) return false;
+  return a.type == b.type && a.cpu_prec == b.cpu_prec && a.cuda_prec == b.cuda_prec
+    && a.cuda_prec_sloppy == b.cuda_prec_sloppy && a.cuda_prec_precondition == b.cuda_prec_precondition
+    && a.cuda_prec_refinement_sloppy == b.cuda_prec_refinement_sloppy && a.reconstruct == b.reconstruct
+    && a.reconstruct_sloppy == b.reconstruct_sloppy && a.reconstruct_precondition == b.reconstruct_precondition
+    && a.reconstruct_refinement_sloppy == b.reconstruct_refinement_sloppy && a.scale == b.scale
+    && a.tadpole_coeff == b.tadpole_coeff && a.staggered_phase_type == b.staggered_phase_type && a.ga_pad == b.ga_pad;
+}
+
+static bool matchesResidentLink(const MILCLinkFingerprint &resident, const void *links, const QudaGaugeParam &param,
+                                uint64_t checksum)
+{
+  if (resident.links != links) return false;
+  if (links == nullptr) return true;
+  return sameLinkParam(resident.param, param) && resident.checksum == checksum;
+}
+
+/**
+   Make the MILC fat and long links resident in QUDA, skipping the
+   reorder and upload if the resident links were loaded from the same
+   unchanged buffers with the same parameters.
+   @return Whether the links were (re)loaded
+*/
+static bool loadMILCLinks(const void *fatlink, const void *longlink, QudaGaugeParam &fat_param,
+                          QudaGaugeParam &long_param)
+{
+  // links that QUDA created itself stay resident until invalidated
+  if (!invalidate_quda_gauge && create_quda_gauge) return false;
+
+  const bool cache = !create_quda_gauge && cacheMILCLinks();
+  uint64_t fat_checksum = 0;
+  uint64_t long_checksum = 0;
+  if (cache) {
+    fat_checksum = milcLinkChecksum(fatlink, fat_param);
+    if (longlink != nullptr) long_checksum = milcLinkChecksum(longlink, long_param);
+    // loadGaugeQuda is collective, so every rank must agree: reload if the links changed on any rank
+    bool match = !invalidate_quda_gauge && matchesResidentLink(resident_fat_link, fatlink, fat_param, fat_checksum)
+      && matchesResidentLink(resident_long_link, longlink, long_param, long_checksum);
+    double changed = match ? 0.0 : 1.0;
+    comm_allreduce_max(&changed);
+    if (changed == 0.0) {
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printfQuda("Reusing resident MILC links\n");
+      return false;
+    }
+  }
+
+  loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
+  if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
+  invalidate_quda_gauge = false;
+
+  if (cache) {
+    resident_fat_link.links = fatlink;
+    resident_fat_link.checksum = fat_checksum;
+    resident_fat_link.param = fat_param;
+    resident_long_link.links = longlink;
+    resident_long_link.checksum = long_checksum;
+    resident_long_link.param = long_param;
+  }
+  return true;
+}
+
+// free the links after a solve unless QUDA created them or they are cached
+static void releaseMILCLinks()
+{
+  if (!create_quda_gauge && !cacheMILCLinks()) invalidateGaugeQuda();
+}
+
 void qudaLoadKSLink(int prec, QudaFatLinkArgs_t fatlink_args,
     const double act_path_coeff[6], void* inlink, void* fatlink, void* longlink)
 {
@@ -955,11 +1083,7 @@ void qudaMultishiftInvert(int external_precision, int quda_precision, int num_of
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
   // set the solver
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadMILCLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -979,7 +1103,7 @@ void qudaMultishiftInvert(int external_precision, int quda_precision, int num_of
     final_fermilab_residual[i] = invertParam.true_res_hq_offset[i];
   } // end loop over number of offsets
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaMultiShiftInvert
@@ -1042,11 +1166,7 @@ void qudaInvert(int external_precision, int quda_precision, double mass, QudaInv
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadMILCLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1059,7 +1179,7 @@ void qudaInvert(int external_precision, int quda_precision, double mass, QudaInv
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaInvert
@@ -1095,11 +1215,7 @@ void qudaDslash(int external_precision, int quda_precision, QudaInvertArgs_t inv
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadMILCLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1110,7 +1226,7 @@ void qudaDslash(int external_precision, int quda_precision, QudaInvertArgs_t inv
 	     static_cast<char*>(src) + src_offset*host_precision,
 	     &invertParam, local_parity);
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaDslash
@@ -1157,11 +1273,7 @@ void qudaInvertMsrc(int external_precision, int quda_precision, double mass, Qud
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadMILCLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1182,7 +1294,7 @@ void qudaInvertMsrc(int external_precision, int quda_precision, double mass, Qud
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaInvert
@@ -1254,11 +1366,7 @@ void qudaEigCGInvert(int external_precision, int quda_precision, double mass, Qu
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if ((invalidate_quda_gauge || !create_quda_gauge) && (rhs_idx == 0)) { // do this for the first RHS
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  if (rhs_idx == 0) loadMILCLinks(fatlink, longlink, fat_param, long_param); // do this for the first RHS
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1277,7 +1385,7 @@ void qudaEigCGInvert(int external_precision, int quda_precision, double mass, Qu
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge && last_rhs_flag) invalidateGaugeQuda();
+  if (last_rhs_flag) releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaEigCGInvert
@@ -2017,18 +2125,14 @@ void *qudaMultigridCreate(int external_precision, int quda_precision, double mas
   // if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
   invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadMILCLinks(fatlink, longlink, fat_param, long_param);
 
   mg_pack->mg_preconditioner = newMultigridQuda(&mg_pack->mg_param);
   mg_pack->last_mass = mass;
 
   invalidate_quda_mg = false;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 
@@ -2107,11 +2211,8 @@ void qudaInvertMG(int external_precision, int quda_precision, double mass, QudaI
     invalidate_quda_mg = true;
   }
 
-  if (invalidate_quda_gauge || !create_quda_gauge || invalidate_quda_mg) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-
+  // the preconditioner must be rebuilt whenever the links change
+  if (loadMILCLinks(fatlink, longlink, fat_param, long_param) || invalidate_quda_mg) {
     // FIXME: hack to reset gaugeFatPrecise (see interface_quda.cpp), etc.
     // Solution is to have a version of this that _only_
     // rebuilds the Dirac matrices, I believe.
@@ -2151,7 +2252,7 @@ void qudaInvertMG(int external_precision, int quda_precision, double mass, QudaI
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  releaseMILCLinks();
 
   qudamilc_called<false>(__func__, verbosity);
 }
@@ -2338,7 +2439,7 @@ void qudaLoadGaugeField(int external_precision,
 
 void qudaFreeGaugeField() {
     qudamilc_called<true>(__func__);
-  freeGaugeQuda();
+  invalidateGaugeQuda();
     qudamilc_called<false>(__func__);
 } // qudaFreeGaugeField
 
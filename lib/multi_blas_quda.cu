@@ -81,6 +81,7 @@ namespace quda {
           strcat(aux, ",");
           strcat(aux, y[0]->AuxString());
         }
+        if (location == QUDA_CPU_FIELD_LOCATION) strcat(aux, ",CPU");
 
 #ifdef JITIFY
         ::quda::create_jitify_program("kernels/multi_blas_core.cuh");
@@ -137,6 +138,30 @@ namespace quda {
 #endif
       }
 
+      /**
+         @brief Host variant of set_param for multi-1d functors: the
+         coefficients are stored in the functor, so this is identical
+         to the device variant.
+      */
+      template <bool multi_1d, typename coeff_t, typename Arg> typename std::enable_if<multi_1d, void>::type
+      set_param_host(signed char *&, std::vector<coeff_t> &, Arg &arg, char select, const T &h, const qudaStream_t &stream)
+      {
+        set_param<multi_1d>(nullptr, arg, select, h, stream);
+      }
+
+      /**
+         @brief Host variant of set_param: the host functor reads the
+         coefficient matrix through the given host pointer, so convert
+         the coefficients to the functor's precision and point it there.
+      */
+      template <bool multi_1d, typename coeff_t, typename Arg> typename std::enable_if<!multi_1d, void>::type
+      set_param_host(signed char *&buf_h, std::vector<coeff_t> &buf, Arg &, char, const T &h, const qudaStream_t &)
+      {
+        buf.resize(NXZ * NYW);
+        for (int i = 0; i < NXZ * NYW; i++) buf[i] = coeff_t(h.data[i]);
+        buf_h = reinterpret_cast<signed char *>(buf.data());
+      }
+
       template <int NXZ> void compute(const qudaStream_t &stream)
       {
         staticCheck<NXZ, store_t, y_store_t, decltype(f)>(f, x, y);
@@ -190,7 +215,35 @@ namespace quda {
 
           tp.block.x /= tp.aux.x; // restore block size
         } else {
-          errorQuda("Only implemented for GPU fields");
+          if (checkOrder(*x[0], *y[0], *z[0], *w[0]) != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("CPU Blas functions expect AoS field order");
+
+          using host_store_t = typename host_type_mapper<store_t>::type;
+          using host_y_store_t = typename host_type_mapper<y_store_t>::type;
+          using host_real_t = typename mapper<host_y_store_t>::type;
+          Functor<host_real_t> f_(NXZ, NYW);
+
+          // redefine site_unroll with host_store types to ensure we have correct N/Ny/M values
+          constexpr bool site_unroll = !std::is_same<host_store_t, host_y_store_t>::value || isFixed<host_store_t>::value;
+          constexpr int N = n_vector<host_store_t, false, nSpin, site_unroll>();
+          constexpr int Ny = n_vector<host_y_store_t, false, nSpin, site_unroll>();
+          constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
+          const int length = x[0]->Length() / (nParity * M);
+
+          MultiBlasArg<NXZ, host_store_t, N, host_y_store_t, Ny, decltype(f_)> arg(x, y, z, w, f_, NYW, length);
+
+          using coeff_t = typename decltype(f_)::coeff_t;
+          std::vector<coeff_t> a_h, b_h, c_h;
+          if (a.data) set_param_host<decltype(f_)::multi_1d>(Amatrix_h, a_h, arg, 'a', a, stream);
+          if (b.data) set_param_host<decltype(f_)::multi_1d>(Bmatrix_h, b_h, arg, 'b', b, stream);
+          if (c.data) set_param_host<decltype(f_)::multi_1d>(Cmatrix_h, c_h, arg, 'c', c, stream);
+
+          multiBlasCPU<host_real_t, M, NXZ>(arg, nParity);
+
+          // restore the host coefficient pointers since the converted copies are about to go out of scope
+          Amatrix_h = reinterpret_cast<signed char *>(const_cast<typename T::type *>(a.data));
+          Bmatrix_h = reinterpret_cast<signed char *>(const_cast<typename T::type *>(b.data));
+          Cmatrix_h = reinterpret_cast<signed char *>(const_cast<typename T::type *>(c.data));
         }
       }
 
@@ -276,6 +329,11 @@ namespace quda {
 #endif
       }
 
+      bool advanceTuneParam(TuneParam &param) const
+      {
+        return location == QUDA_CPU_FIELD_LOCATION ? false : TunableVectorY::advanceTuneParam(param);
+      }
+
       int blockStep() const { return deviceProp.warpSize / warp_split; }
       int blockMin() const { return deviceProp.warpSize / warp_split; }
 
@@ -129,6 +129,7 @@ namespace quda {
           strcat(aux, y[0]->AuxString());
         }
         strcat(aux, nParity == 2 ? ",nParity=2" : ",nParity=1");
+        if (location == QUDA_CPU_FIELD_LOCATION) strcat(aux, ",CPU");
 
         // since block dot product and block norm use the same functors, we need to distinguish them
         bool is_norm = false;
@@ -215,7 +216,32 @@ namespace quda {
 #endif
           multiReduceLaunch<device_real_t, M, NXZ>(result, arg, tp, stream, *this);
         } else {
-          errorQuda("Only implemented for GPU fields");
+          if (checkOrder(*x[0], *y[0], *z[0], *w[0]) != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("CPU Blas functions expect AoS field order");
+
+          using host_store_t = typename host_type_mapper<store_t>::type;
+          using host_y_store_t = typename host_type_mapper<y_store_t>::type;
+          using host_real_t = typename mapper<host_y_store_t>::type;
+          Reducer<double, host_real_t> r_(NXZ, NYW);
+
+          // redefine site_unroll with host_store types to ensure we have correct N/Ny/M values
+          constexpr bool site_unroll = !std::is_same<host_store_t, host_y_store_t>::value || isFixed<host_store_t>::value;
+          constexpr int N = n_vector<host_store_t, false, nSpin, site_unroll>();
+          constexpr int Ny = n_vector<host_y_store_t, false, nSpin, site_unroll>();
+          constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
+          const int length = x[0]->Length() / (nParity * M);
+
+          MultiReduceArg<NXZ, host_store_t, N, host_y_store_t, Ny, decltype(r_)> arg(x, y, z, w, r_, NYW, length, nParity, tp);
+
+          // none of the present multi-reducers take coefficients
+          if (a.data || b.data || c.data) errorQuda("Coefficient matrices not supported by the host multi-reduce");
+
+          auto result_ = multiReduceCPU<host_real_t, M, NXZ>(arg, nParity);
+
+          // same transpose as the device path
+          for (int i = 0; i < NXZ; i++) {
+            for (int j = 0; j < NYW; j++) { result[i * NYW + j] = result_[j * NXZ + i]; }
+          }
         }
       }
 
@@ -249,6 +275,11 @@ namespace quda {
         else errorQuda("x.size %lu greater than MAX_MULTI_BLAS_N %d", x.size(), MAX_MULTI_BLAS_N);
       }
 
+      bool advanceTuneParam(TuneParam &param) const
+      {
+        return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
+      }
+
       bool advanceGridDim(TuneParam &param) const
       {
         bool rtn = Tunable::advanceGridDim(param);
@@ -610,6 +610,12 @@ namespace quda
       }
       param_coarse_solver->inv_type_precondition = (param.level<param.Nlevel-2 || coarse->presmoother) ? QUDA_MG_INVERTER : QUDA_INVALID_INVERTER;
       param_coarse_solver->preconditioner = (param.level<param.Nlevel-2 || coarse->presmoother) ? coarse : nullptr;
+      if (param_coarse_solver->inv_type == QUDA_DIRECT_LU_INVERTER) {
+        if (param.level < param.Nlevel - 2) errorQuda("Direct coarse solver only supported on the coarsest level");
+        // the coarsest grid is solved exactly so there is nothing to precondition
+        param_coarse_solver->inv_type_precondition = QUDA_INVALID_INVERTER;
+        param_coarse_solver->preconditioner = nullptr;
+      }
       param_coarse_solver->mg_instance = true;
       param_coarse_solver->verbosity_precondition = param.mg_global.verbosity[param.level+1];
 
@@ -660,6 +666,13 @@ namespace quda
         param_coarse_solver->maxiter = param.mg_global.coarse_solver_maxiter[param.level + 1];
       }
 
+      if (param_coarse_solver->inv_type == QUDA_DIRECT_LU_INVERTER) {
+        // run a dummy solve so the operator is assembled and factorized during the setup
+        zero(*r_coarse);
+        (*coarse_solver)(*x_coarse, *r_coarse);
+        setOutputPrefix(prefix); // restore since we just popped back from coarse grid
+      }
+
       if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Assigned coarse solver to preconditioned GCR solver\n");
     } else {
       errorQuda("Multigrid cycle type %d not supported", param.cycle_type);
@@ -1233,7 +1246,7 @@ namespace quda
       vec_infile += std::to_string(param.level);
       vec_infile += "_nvec_";
       vec_infile += std::to_string(param.mg_global.n_vec[param.level]);
-      VectorIO io(vec_infile);
+      VectorIO io(vec_infile, false, param.mg_global.vec_io_chunk_size);
       io.load(B);
       popLevel(param.level);
       profile_global.TPSTOP(QUDA_PROFILE_IO);
@@ -1255,7 +1268,7 @@ namespace quda
       vec_outfile += std::to_string(param.level);
       vec_outfile += "_nvec_";
       vec_outfile += std::to_string(param.mg_global.n_vec[param.level]);
-      VectorIO io(vec_outfile);
+      VectorIO io(vec_outfile, false, param.mg_global.vec_io_chunk_size);
       io.save(B);
       popLevel(param.level);
       profile_global.TPSTOP(QUDA_PROFILE_IO);
@@ -481,3 +481,76 @@ void write_spinor_field(const char *filename, void *V[], QudaPrecision precision
   QIO_close_write(outfile);
   printfQuda("%s: Closed file for writing\n",__func__);
 }
+
+void *open_spinor_field_read(const char *filename, const int *X, QudaSiteSubset subset)
+{
+  quda_this_node = QMP_get_node_number();
+
+  set_layout(X, subset);
+
+  QIO_Reader *infile = open_test_input(filename, QIO_UNKNOWN, QIO_PARALLEL);
+  if (infile == NULL) { errorQuda("Open file failed\n"); }
+  return infile;
+}
+
+// returns the number of fields in the next record without consuming it
+int read_spinor_record_count(void *handle)
+{
+  QIO_Reader *infile = static_cast<QIO_Reader *>(handle);
+
+  char dummy[100] = "";
+  QIO_RecordInfo *rec_info = QIO_create_record_info(0, NULL, NULL, 0, dummy, dummy, 0, 0, 0, 0);
+  QIO_String *xml_record_in = QIO_string_create();
+
+  int status = QIO_read_record_info(infile, rec_info, xml_record_in);
+  if (status != QIO_SUCCESS) { errorQuda("QIO_read_record_info failed %d\n", status); }
+  int count = QIO_get_datacount(rec_info);
+
+  QIO_string_destroy(xml_record_in);
+  QIO_destroy_record_info(rec_info);
+  return count;
+}
+
+void read_spinor_record(void *handle, void *V[], QudaPrecision precision, QudaSiteSubset subset, QudaParity parity,
+                        int nColor, int nSpin, int count)
+{
+  QIO_Reader *infile = static_cast<QIO_Reader *>(handle);
+  int status = read_field(infile, 2 * nSpin * nColor, count, V, precision, subset, parity, nSpin, nColor);
+  if (status) { errorQuda("read_spinor_record failed %d\n", status); }
+}
+
+void close_spinor_field_read(void *handle)
+{
+  QIO_close_read(static_cast<QIO_Reader *>(handle));
+  printfQuda("%s: Closed file for reading\n", __func__);
+}
+
+void *open_spinor_field_write(const char *filename, const int *X, QudaSiteSubset subset)
+{
+  quda_this_node = QMP_get_node_number();
+
+  set_layout(X, subset);
+
+  QIO_Writer *outfile = open_test_output(filename, QIO_SINGLEFILE, QIO_PARALLEL, QIO_ILDGNO);
+  if (outfile == NULL) { errorQuda("Open file failed\n"); }
+  return outfile;
+}
+
+void write_spinor_record(void *handle, void *V[], QudaPrecision precision, QudaSiteSubset subset, QudaParity parity,
+                         int nColor, int nSpin, int count)
+{
+  QIO_Writer *outfile = static_cast<QIO_Writer *>(handle);
+
+  char type[128];
+  sprintf(type, "QUDA_%sNs%dNc%d_ColorSpinorField", (precision == QUDA_DOUBLE_PRECISION) ? "D" : "F", nSpin, nColor);
+
+  int status
+    = write_field(outfile, 2 * nSpin * nColor, count, V, precision, precision, subset, parity, nSpin, nColor, type);
+  if (status) { errorQuda("write_spinor_record failed %d\n", status); }
+}
+
+void close_spinor_field_write(void *handle)
+{
+  QIO_close_write(static_cast<QIO_Writer *>(handle));
+  printfQuda("%s: Closed file for writing\n", __func__);
+}
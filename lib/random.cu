@@ -29,6 +29,22 @@ namespace quda {
         X[i] = X_[i];
       }
     }
+
+    /**
+       @brief Global lexicographic index of a local site, which labels
+       the RNG stream at that site
+       @param[in] id Local checkerboard index
+       @param[in] parity Site parity
+    */
+    __device__ __host__ inline unsigned long long globalIndex(int id, int parity) const
+    {
+      int x[4];
+      getCoords(x, id, X, parity);
+      for (int i = 0; i < 4; i++) x[i] += commCoord[i] * X[i];
+      return (((static_cast<unsigned long long>(x[3]) * commDim[2] * X[2] + x[2]) * commDim[1] * X[1]) + x[1])
+        * commDim[0] * X[0]
+        + x[0];
+    }
   };
 
   /**
@@ -44,13 +60,7 @@ namespace quda {
     int parity = blockIdx.y * blockDim.y + threadIdx.y;
     if (id < size_cb) {
       // Each thread gets same seed, a different sequence number, no offset
-      int x[4];
-      getCoords(x, id, arg.X, parity);
-      for (int i = 0; i < 4; i++) x[i] += arg.commCoord[i] * arg.X[i];
-      int idd
-        = (((x[3] * arg.commDim[2] * arg.X[2] + x[2]) * arg.commDim[1] * arg.X[1]) + x[1]) * arg.commDim[0] * arg.X[0]
-        + x[0];
-      curand_init(seed, idd, 0, &state[parity * size_cb + id]);
+      curand_init(seed, arg.globalIndex(id, parity), 0, &state[parity * size_cb + id]);
     }
   }
 
@@ -73,53 +83,94 @@ namespace quda {
     qudaDeviceSynchronize();
   }
 
-  RNG::RNG(const LatticeField &meta, unsigned long long seedin) :
+  /**
+     @brief Initialize host RNG states: each site is given its global
+     index as its stream and the seed as its key, with its counter
+     starting at zero
+     @param state Host RNG state array
+     @param seed initial seed for RNG
+     @param size_cb Checkerboarded size of the host RNG state array
+     @param n_parity Number of parities (1 or 2)
+     @param X array of lattice dimensions
+  */
+  void init_host_random(HostRNGState *state, unsigned long long seed, int size_cb, int n_parity, int X[4])
+  {
+    rngArg arg(X);
+#pragma omp parallel for collapse(2)
+    for (int parity = 0; parity < n_parity; parity++) {
+      for (int id = 0; id < size_cb; id++) {
+        HostRNGState &s = state[parity * size_cb + id];
+        s.key[0] = static_cast<uint32_t>(seed);
+        s.key[1] = static_cast<uint32_t>(seed >> 32);
+        s.site = arg.globalIndex(id, parity);
+        s.counter = 0;
+      }
+    }
+  }
+
+  static void printRNGType(QudaFieldLocation location)
+  {
+    if (getVerbosity() < QUDA_VERBOSE) return;
+    if (location == QUDA_CPU_FIELD_LOCATION)
+      printfQuda("Using host Philox4x32-10\n");
+    else
+#if defined(XORWOW)
+      printfQuda("Using curandStateXORWOW\n");
+#else
+      printfQuda("Using curandStateMRG32k3a\n");
+#endif
+  }
+
+  RNG::RNG(const LatticeField &meta, unsigned long long seedin, QudaFieldLocation location) :
+    location(location),
     seed(seedin),
     size(meta.Volume()),
     size_cb(meta.VolumeCB())
   {
     state = nullptr;
+    host_state = nullptr;
     for (int i = 0; i < 4; i++) X[i] = meta.X()[i];
-#if defined(XORWOW)
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using curandStateXORWOW\n");
-#elif defined(RG32k3a)
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using curandStateMRG32k3a\n");
-#else
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using curandStateMRG32k3a\n");
-#endif
+    printRNGType(location);
   }
 
-  RNG::RNG(const LatticeFieldParam &param, unsigned long long seedin) : seed(seedin), size(1), size_cb(1)
+  RNG::RNG(const LatticeFieldParam &param, unsigned long long seedin, QudaFieldLocation location) :
+    location(location),
+    seed(seedin),
+    size(1),
+    size_cb(1)
   {
     state = nullptr;
+    host_state = nullptr;
     for (int i = 0; i < 4; i++) {
       X[i] = param.x[i];
       size *= X[i];
     }
     size_cb = size / param.siteSubset;
-
-#if defined(XORWOW)
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using curandStateXORWOW\n");
-#elif defined(RG32k3a)
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using curandStateMRG32k3a\n");
-#else
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using curandStateMRG32k3a\n");
-#endif
+    printRNGType(location);
   }
 
   /**
-     @brief Initialize CURAND RNG states
+     @brief Initialize CURAND or host RNG states
   */
   void RNG::Init() {
     AllocateRNG();
-    launch_kernel_random(state, seed, size_cb, size / size_cb, X);
+    if (location == QUDA_CPU_FIELD_LOCATION)
+      init_host_random(host_state, seed, size_cb, size / size_cb, X);
+    else
+      launch_kernel_random(state, seed, size_cb, size / size_cb, X);
   }
 
   /**
-     @brief Allocate Device memory for CURAND RNG states
+     @brief Allocate Device memory for CURAND RNG states, or host
+     memory for host RNG states
   */
   void RNG::AllocateRNG() {
-    if (size > 0 && state == nullptr) {
+    if (size > 0 && location == QUDA_CPU_FIELD_LOCATION && host_state == nullptr) {
+      host_state = (HostRNGState *)safe_malloc(size * sizeof(HostRNGState));
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Allocated array of host random numbers with size: %.2f MB\n",
+                   size * sizeof(HostRNGState) / (float)(1048576));
+    } else if (size > 0 && location != QUDA_CPU_FIELD_LOCATION && state == nullptr) {
       state = (cuRNGState *)device_malloc(size * sizeof(cuRNGState));
       qudaMemset(state, 0, size * sizeof(cuRNGState));
       if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
@@ -131,10 +182,18 @@ namespace quda {
   }
 
   /**
-     @brief Release Device memory for CURAND RNG states
+     @brief Release Device memory for CURAND RNG states, or host
+     memory for host RNG states
   */
   void RNG::Release() {
-    if (size > 0 && state != nullptr) {
+    if (size > 0 && host_state != nullptr) {
+      host_free(host_state);
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Free array of host random numbers with size: %.2f MB\n",
+                   size * sizeof(HostRNGState) / (float)(1048576));
+      size = 0;
+      host_state = nullptr;
+    } else if (size > 0 && state != nullptr) {
       device_free(state);
       if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
         printfQuda("Free array of random numbers with size: %.2f MB\n", size * sizeof(cuRNGState) / (float)(1048576));
@@ -143,18 +202,28 @@ namespace quda {
     }
   }
 
-  /*! @brief Backup CURAND array states initialization */
+  /*! @brief Backup RNG array states initialization */
   void RNG::backup()
   {
-    backup_state = (cuRNGState *)safe_malloc(size * sizeof(cuRNGState));
-    qudaMemcpy(backup_state, state, size * sizeof(cuRNGState), cudaMemcpyDeviceToHost);
+    if (location == QUDA_CPU_FIELD_LOCATION) {
+      host_backup_state = (HostRNGState *)safe_malloc(size * sizeof(HostRNGState));
+      memcpy(host_backup_state, host_state, size * sizeof(HostRNGState));
+    } else {
+      backup_state = (cuRNGState *)safe_malloc(size * sizeof(cuRNGState));
+      qudaMemcpy(backup_state, state, size * sizeof(cuRNGState), cudaMemcpyDeviceToHost);
+    }
   }
 
-  /*! @brief Restore CURAND array states initialization */
+  /*! @brief Restore RNG array states initialization */
   void RNG::restore()
   {
-    qudaMemcpy(state, backup_state, size * sizeof(cuRNGState), cudaMemcpyHostToDevice);
-    host_free(backup_state);
+    if (location == QUDA_CPU_FIELD_LOCATION) {
+      memcpy(host_state, host_backup_state, size * sizeof(HostRNGState));
+      host_free(host_backup_state);
+    } else {
+      qudaMemcpy(state, backup_state, size * sizeof(cuRNGState), cudaMemcpyHostToDevice);
+      host_free(backup_state);
+    }
   }
 
 } // namespace quda
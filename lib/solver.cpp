@@ -156,6 +156,10 @@ namespace quda {
       report("CG3NR");
       solver = new CG3NR(mat, matSloppy, matPrecon, param, profile);
       break;
+    case QUDA_DIRECT_LU_INVERTER:
+      report("DIRECT-LU");
+      solver = new DirectLU(mat, param, profile);
+      break;
     default:
       errorQuda("Invalid solver type %d", param.inv_type);
     }
@@ -1,11 +1,12 @@
 /*
-  Spinor reordering and copying routines.  These are implemented to
-  un on both CPU and GPU.  Here we are templating on the following:
-  - input precision
-  - output precision
+  Spinor noise generation routines.  These are implemented to run on
+  both CPU and GPU, on the host (Philox) or device (curand) states of
+  an RNG respectively.  Here we are templating on the following:
+  - precision
   - number of colors
   - number of spins
   - field ordering
+  - noise type
 */
 
 #include <color_spinor_field.h>
@@ -28,42 +29,65 @@ namespace quda {
     Arg(ColorSpinorField &v, RNG &rng) : v(v), nParity(v.SiteSubset()), volumeCB(v.VolumeCB()), rng(rng) { }
   };
 
-  template<typename real, typename Arg> // Gauss
-  __device__ __host__ inline void genGauss(Arg &arg, cuRNGState& localState, int parity, int x_cb, int s, int c) {
-    real phi = 2.0*M_PI*Random<real>(localState);
-    real radius = Random<real>(localState);
-    radius = sqrt(-1.0 * log(radius));
-    arg.v(parity, x_cb, s, c) = complex<real>(radius*cos(phi),radius*sin(phi));
-  }
+  /**
+     @brief Whether a noise type consumes two uniform random numbers
+     per component (else it consumes one)
+  */
+  constexpr bool twoRandom(QudaNoiseType type) { return type == QUDA_NOISE_GAUSS || type == QUDA_NOISE_UNIFORM; }
 
-  template<typename real, typename Arg> // Uniform
-  __device__ __host__ inline void genUniform(Arg &arg, cuRNGState& localState, int parity, int x_cb, int s, int c) {
-    real x = Random<real>(localState);
-    real y = Random<real>(localState);
-    arg.v(parity, x_cb, s, c) = complex<real>(x, y);
+  /**
+     @brief Map uniform random numbers in (0,1] to a noise component
+     - Gauss: complex Gaussian, formed by Box-Muller from (u0, u1)
+     - Uniform: (u0, u1)
+     - Z2: +/-1 with equal probability, formed from u0
+     - Z4: one of {1, i, -1, -i} with equal probability, formed from u0
+  */
+  template <typename real, QudaNoiseType type> __device__ __host__ inline complex<real> genNoise(real u0, real u1)
+  {
+    if (type == QUDA_NOISE_GAUSS) {
+      real phi = 2.0 * M_PI * u0;
+      real radius = sqrt(-1.0 * log(u1));
+      return complex<real>(radius * cos(phi), radius * sin(phi));
+    } else if (type == QUDA_NOISE_UNIFORM) {
+      return complex<real>(u0, u1);
+    } else if (type == QUDA_NOISE_Z2) {
+      return complex<real>(u0 > static_cast<real>(0.5) ? 1.0 : -1.0, 0.0);
+    } else { // Z4
+      switch (static_cast<int>(ceil(4 * u0)) - 1) {
+      case 0: return complex<real>(1.0, 0.0);
+      case 1: return complex<real>(0.0, 1.0);
+      case 2: return complex<real>(-1.0, 0.0);
+      default: return complex<real>(0.0, -1.0);
+      }
+    }
   }
 
-  /** CPU function to reorder spinor fields.  */
+  /**
+     CPU function to generate spinor noise.  Each component of each
+     site draws one block from that site's counter-based host RNG
+     stream (see HostRNGState), in spin-major order, so the result
+     depends only on the RNG seed and state and not on the number of
+     threads.
+  */
   template <typename real, int Ns, int Nc, QudaNoiseType type, typename Arg> void SpinorNoiseCPU(Arg &arg)
   {
-
+#pragma omp parallel for collapse(2)
     for (int parity = 0; parity < arg.nParity; parity++) {
       for (int x_cb = 0; x_cb < arg.volumeCB; x_cb++) {
+        HostRNGState localState = arg.rng.HostState()[parity * arg.volumeCB + x_cb];
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
-            cuRNGState localState = arg.rng.State()[parity * arg.volumeCB + x_cb];
-            if (type == QUDA_NOISE_GAUSS)
-              genGauss<real>(arg, localState, parity, x_cb, s, c);
-            else if (type == QUDA_NOISE_UNIFORM)
-              genUniform<real>(arg, localState, parity, x_cb, s, c);
-            arg.rng.State()[parity * arg.volumeCB + x_cb] = localState;
+            double u0, u1;
+            Random(localState, u0, u1);
+            arg.v(parity, x_cb, s, c) = genNoise<real, type>(u0, u1);
           }
         }
+        arg.rng.HostState()[parity * arg.volumeCB + x_cb] = localState;
       }
     }
   }
 
-  /** CUDA kernel to reorder spinor fields.  Adopts a similar form as the CPU version, using the same inlined functions. */
+  /** CUDA kernel to generate spinor noise.  Uses the same inlined noise function as the CPU version. */
   template <typename real, int Ns, int Nc, QudaNoiseType type, typename Arg>
     __global__ void SpinorNoiseGPU(Arg arg) {
 
@@ -76,8 +100,9 @@ namespace quda {
     cuRNGState localState = arg.rng.State()[parity * arg.volumeCB + x_cb];
     for (int s=0; s<Ns; s++) {
       for (int c=0; c<Nc; c++) {
-        if (type == QUDA_NOISE_GAUSS) genGauss<real>(arg, localState, parity, x_cb, s, c);
-        else if (type == QUDA_NOISE_UNIFORM) genUniform<real>(arg, localState, parity, x_cb, s, c);
+        real u0 = Random<real>(localState);
+        real u1 = twoRandom(type) ? Random<real>(localState) : 0.0;
+        arg.v(parity, x_cb, s, c) = genNoise<real, type>(u0, u1);
       }
     }
     arg.rng.State()[parity * arg.volumeCB + x_cb] = localState;
@@ -102,8 +127,12 @@ namespace quda {
     }
 
     void apply(const qudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      qudaLaunchKernel(SpinorNoiseGPU<real, Ns, Nc, type, Arg>, tp, stream, arg);
+      if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
+        SpinorNoiseCPU<real, Ns, Nc, type>(arg);
+      } else {
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        qudaLaunchKernel(SpinorNoiseGPU<real, Ns, Nc, type, Arg>, tp, stream, arg);
+      }
     }
 
     bool advanceTuneParam(TuneParam &param) const {
@@ -134,6 +163,18 @@ namespace quda {
         noise.apply(0);
         break;
       }
+    case QUDA_NOISE_Z2:
+      {
+        SpinorNoise<real, Ns, Nc, QUDA_NOISE_Z2, Arg<real, Ns, Nc, order> > noise(arg, in);
+        noise.apply(0);
+        break;
+      }
+    case QUDA_NOISE_Z4:
+      {
+        SpinorNoise<real, Ns, Nc, QUDA_NOISE_Z4, Arg<real, Ns, Nc, order> > noise(arg, in);
+        noise.apply(0);
+        break;
+      }
     default:
       errorQuda("Noise type %d not implemented", type);
     }
@@ -147,6 +188,8 @@ namespace quda {
       spinorNoise<real,Ns,Nc,QUDA_FLOAT2_FIELD_ORDER>(in, rngstate, type);
     } else if (in.FieldOrder() == QUDA_FLOAT4_FIELD_ORDER) {
       spinorNoise<real,Ns,Nc,QUDA_FLOAT4_FIELD_ORDER>(in, rngstate, type);
+    } else if (in.FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER) {
+      spinorNoise<real,Ns,Nc,QUDA_SPACE_SPIN_COLOR_FIELD_ORDER>(in, rngstate, type);
     } else {
       errorQuda("Order %d not defined (Ns=%d, Nc=%d)", in.FieldOrder(), Ns, Nc);
     }
@@ -200,14 +243,17 @@ namespace quda {
 
   void spinorNoise(ColorSpinorField &src_, RNG &randstates, QudaNoiseType type)
   {
-    // if src is a CPU field then create GPU field
+    // noise is generated where the RNG lives: if src is not a suitable field there, create one
+    const bool host = randstates.Location() == QUDA_CPU_FIELD_LOCATION;
     ColorSpinorField *src = &src_;
-    if (src_.Location() == QUDA_CPU_FIELD_LOCATION || src_.Precision() < QUDA_SINGLE_PRECISION) {
+    if (src_.Location() != randstates.Location() || src_.Precision() < QUDA_SINGLE_PRECISION
+        || (host && src_.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)) {
       ColorSpinorParam param(src_);
       QudaPrecision prec = std::max(src_.Precision(), QUDA_SINGLE_PRECISION);
-      param.setPrecision(prec, prec, true); // change to native field order
+      param.setPrecision(prec, prec, !host); // change to native field order on the device
+      if (host) param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
       param.create = QUDA_NULL_FIELD_CREATE;
-      param.location = QUDA_CUDA_FIELD_LOCATION;
+      param.location = randstates.Location();
       src = ColorSpinorField::Create(param);
     }
 
@@ -218,14 +264,14 @@ namespace quda {
     }
 
     if (src != &src_) {
-      src_ = *src; // upload result
+      src_ = *src; // copy result
       delete src;
     }
   }
 
   void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type)
   {
-    RNG *randstates = new RNG(src, seed);
+    RNG *randstates = new RNG(src, seed, src.Location());
     randstates->Init();
     spinorNoise(src, *randstates, type);
     randstates->Release();
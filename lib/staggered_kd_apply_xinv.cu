@@ -130,6 +130,47 @@ namespace quda {
     if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printfQuda("... done applying KD block\n");
   }
 
+  /**
+     @brief Apply the staggered Kahler-Dirac block inverse to host
+     spinors in space-spin-color order
+
+     @param out[out] output staggered spinor
+     @param in[in] input staggered spinor
+     @param xInv[in] KD block inverse accessor
+     @param Xinv_[in] KD block inverse
+     @param dagger[in] whether to apply the dagger of the inverse
+  */
+  template <typename vFloatSpinor, int fineColor, int fineSpin, int coarseDof, typename xInvGauge>
+  void applyStaggeredKDBlockCPU(ColorSpinorField &out, const ColorSpinorField &in, const xInvGauge &xInv,
+                                const GaugeField &Xinv_, bool dagger)
+  {
+    if (out.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || in.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+      errorQuda("Unsupported field order out=%d in=%d", out.FieldOrder(), in.FieldOrder());
+
+    int x_size[QUDA_MAX_DIM] = { };
+    int xc_size[QUDA_MAX_DIM] = { };
+    for (int i = 0; i < 4; i++) {
+      x_size[i] = out.X()[i];
+      xc_size[i] = Xinv_.X()[i];
+      if (2 * xc_size[i] != x_size[i]) {
+        errorQuda("Inconsistent fine dimension %d and coarse KD dimension %d", x_size[i], xc_size[i]);
+      }
+    }
+
+    using real = typename mapper<vFloatSpinor>::type;
+    using csFine = colorspinor::FieldOrderCB<real, fineSpin, fineColor, 1, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, vFloatSpinor>;
+    const csFine inAccessor(in);
+    csFine outAccessor(out);
+
+    if (dagger) {
+      ApplyStaggeredKDBlockCPUArg<real, coarseDof, fineColor, true, csFine, xInvGauge> arg(outAccessor, inAccessor, xInv, x_size, xc_size);
+      ApplyStaggeredKDBlockCPU(arg);
+    } else {
+      ApplyStaggeredKDBlockCPUArg<real, coarseDof, fineColor, false, csFine, xInvGauge> arg(outAccessor, inAccessor, xInv, x_size, xc_size);
+      ApplyStaggeredKDBlockCPU(arg);
+    }
+  }
+
   // create accessors, specify dagger vs non-dagger
   template <typename vFloatSpinor, typename vFloatGauge, int fineColor, int fineSpin, int coarseDof>
   void applyStaggeredKDBlock(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &Xinv, bool dagger)
@@ -141,6 +182,11 @@ namespace quda {
     using xInvCoarse = typename gauge::FieldOrder<typename mapper<vFloatGauge>::type,coarseDof,1,xOrder,true,vFloatGauge>;
     xInvCoarse xInvAccessor(const_cast<GaugeField &>(Xinv));
 
+    if (out.Location() == QUDA_CPU_FIELD_LOCATION) {
+      applyStaggeredKDBlockCPU<vFloatSpinor, fineColor, fineSpin, coarseDof>(out, in, xInvAccessor, Xinv, dagger);
+      return;
+    }
+
     // Create the accessors for out, in
     constexpr bool spin_project = false;
     constexpr bool spinor_direct_load = false; // seems legacy? false means texture load
@@ -210,10 +256,7 @@ namespace quda {
   void ApplyStaggeredKahlerDiracInverse(ColorSpinorField &out, const ColorSpinorField &in, const GaugeField &Xinv, bool dagger)
   {
 #if defined(GPU_STAGGERED_DIRAC)
-    auto location = checkLocation(out, in, Xinv);
-
-    if (location == QUDA_CPU_FIELD_LOCATION)
-      errorQuda("There is no support for applying the KD operator to CPU fields (yet)");
+    checkLocation(out, in, Xinv);
 
     // the staggered KD block inverse can only be applied to a full field
     if (out.SiteSubset() != QUDA_FULL_SITE_SUBSET || out.SiteSubset() != QUDA_FULL_SITE_SUBSET)
@@ -241,6 +241,65 @@ namespace quda {
 #endif
   }
 
+  /**
+     @brief Build and invert the KD block of every hypercube on the
+     host in a single fused, threaded sweep (see
+     ComputeStaggeredKDBlockInverseCPU)
+
+     @param Xinv[out] KD block inverse, in MILC order
+     @param g[in] Fine gauge field, in QDP order
+     @param mass[in] mass
+   */
+  template <typename Float, int fineColor>
+  void calculateStaggeredKDBlockInverseCPU(GaugeField &Xinv, const GaugeField &g, const double mass)
+  {
+    constexpr int coarseDof = 16 * fineColor;
+    if (Xinv.Ncolor() != coarseDof) errorQuda("Unsupported number of Kahler-Dirac dof %d\n", Xinv.Ncolor());
+    if (g.FieldOrder() != QUDA_QDP_GAUGE_ORDER) errorQuda("Unsupported field order %d\n", g.FieldOrder());
+
+    using gFine = typename gauge::FieldOrder<Float,fineColor,1,QUDA_QDP_GAUGE_ORDER>;
+    using xInvCoarse = typename gauge::FieldOrder<Float,coarseDof,1,QUDA_MILC_GAUGE_ORDER>;
+    gFine gAccessor(const_cast<GaugeField&>(g));
+    xInvCoarse xInvAccessor(Xinv);
+
+    const int nDim = 4;
+    int x_size[QUDA_MAX_DIM] = { };
+    int xc_size[QUDA_MAX_DIM] = { };
+    for (int i = 0; i < nDim; i++) {
+      x_size[i] = g.X()[i];
+      xc_size[i] = Xinv.X()[i];
+      if (2 * xc_size[i] != x_size[i]) {
+        errorQuda("Inconsistent fine dimension %d and coarse KD dimension %d", x_size[i], xc_size[i]);
+      }
+    }
+    x_size[4] = xc_size[4] = 1;
+
+    using Arg = CalculateStaggeredKDBlockInverseCPUArg<Float,fineColor,gFine,xInvCoarse>;
+    Arg arg(xInvAccessor, gAccessor, mass, x_size, xc_size);
+    ComputeStaggeredKDBlockInverseCPU(arg);
+
+    // Gauss-Jordan elimination costs n^3 complex multiply-adds per block
+    blas::flops += 8ll * coarseDof * coarseDof * coarseDof * Xinv.Volume();
+  }
+
+  void calculateStaggeredKDBlockInverseCPU(GaugeField &Xinv, const GaugeField &g, const double mass)
+  {
+#if defined(GPU_STAGGERED_DIRAC)
+    if (g.Ncolor() != 3) errorQuda("Unsupported number of colors %d\n", g.Ncolor());
+    checkPrecision(Xinv, g);
+
+    if (Xinv.Precision() == QUDA_DOUBLE_PRECISION) {
+      calculateStaggeredKDBlockInverseCPU<double,3>(Xinv, g, mass);
+    } else if (Xinv.Precision() == QUDA_SINGLE_PRECISION) {
+      calculateStaggeredKDBlockInverseCPU<float,3>(Xinv, g, mass);
+    } else {
+      errorQuda("Unsupported precision %d", Xinv.Precision());
+    }
+#else
+    errorQuda("Staggered fermion support has not been built");
+#endif
+  }
+
   // Calculates the inverse KD block and puts the result in Xinv. Assumes Xinv has been allocated, in MILC data order
   void BuildStaggeredKahlerDiracInverse(GaugeField &Xinv, const cudaGaugeField &gauge, const double mass)
   {
@@ -255,9 +314,6 @@ namespace quda {
     QudaPrecision precision = Xinv.Precision();
     QudaFieldLocation location = Xinv.Location();
 
-    // Logic copied from `staggered_coarse_op.cu`
-    GaugeField *U = location == QUDA_CUDA_FIELD_LOCATION ? const_cast<cudaGaugeField*>(&gauge) : nullptr;
-
     if (location == QUDA_CPU_FIELD_LOCATION) {
 
       //First make a cpu gauge field from the cuda gauge field
@@ -274,41 +330,42 @@ namespace quda {
       gf_param.nFace = 1;
       gf_param.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
 
-      U = new cpuGaugeField(gf_param);
+      cpuGaugeField U(gf_param);
 
       //Copy the cuda gauge field to the cpu
-      gauge.saveCPUField(*static_cast<cpuGaugeField*>(U));
+      gauge.saveCPUField(U);
 
-    } else if (location == QUDA_CUDA_FIELD_LOCATION) {
+      // X is never formed on the host: each block is built and inverted in cache
+      calculateStaggeredKDBlockInverseCPU(Xinv, U, mass);
 
-      // no reconstruct not strictly necessary, for now we do this for simplicity so
-      // we can take advantage of fine-grained access like in "staggered_coarse_op.cu"
-      // technically don't need to require the precision check, but it should
-      // generally be equal anyway
-
-      // FIXME: make this work for any gauge precision
-      if (gauge.Reconstruct() != QUDA_RECONSTRUCT_NO || gauge.Precision() != precision || gauge.Precision() < QUDA_SINGLE_PRECISION) {
-        GaugeFieldParam gf_param(gauge);
-        gf_param.reconstruct = QUDA_RECONSTRUCT_NO;
-        gf_param.order = QUDA_FLOAT2_GAUGE_ORDER; // guaranteed for no recon
-        gf_param.setPrecision( precision == QUDA_DOUBLE_PRECISION ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION );
-        U = new cudaGaugeField(gf_param);
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Xinv = %e\n", Xinv.norm2(0));
+      return;
+    }
 
-        U->copy(gauge);
-      }
+    // Logic copied from `staggered_coarse_op.cu`
+    GaugeField *U = const_cast<cudaGaugeField*>(&gauge);
+
+    // no reconstruct not strictly necessary, for now we do this for simplicity so
+    // we can take advantage of fine-grained access like in "staggered_coarse_op.cu"
+    // technically don't need to require the precision check, but it should
+    // generally be equal anyway
+
+    // FIXME: make this work for any gauge precision
+    if (gauge.Reconstruct() != QUDA_RECONSTRUCT_NO || gauge.Precision() != precision || gauge.Precision() < QUDA_SINGLE_PRECISION) {
+      GaugeFieldParam gf_param(gauge);
+      gf_param.reconstruct = QUDA_RECONSTRUCT_NO;
+      gf_param.order = QUDA_FLOAT2_GAUGE_ORDER; // guaranteed for no recon
+      gf_param.setPrecision( precision == QUDA_DOUBLE_PRECISION ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION );
+      U = new cudaGaugeField(gf_param);
+
+      U->copy(gauge);
     }
 
     // Create X based on Xinv, but switch to a native ordering
-    // for a GPU setup.
-    GaugeField *X = nullptr;
     GaugeFieldParam x_param(Xinv);
-    if (location == QUDA_CUDA_FIELD_LOCATION) {
-      x_param.order = QUDA_FLOAT2_GAUGE_ORDER;
-      x_param.setPrecision(x_param.Precision());
-      X = static_cast<GaugeField*>(new cudaGaugeField(x_param));
-    } else {
-      X = static_cast<GaugeField*>(new cpuGaugeField(x_param));
-    }
+    x_param.order = QUDA_FLOAT2_GAUGE_ORDER;
+    x_param.setPrecision(x_param.Precision());
+    GaugeField *X = static_cast<GaugeField*>(new cudaGaugeField(x_param));
 
     // Calculate X
     calculateStaggeredKDBlock(*X, *U, mass);
@@ -316,7 +373,7 @@ namespace quda {
     // Invert X
     // Logic copied from `coarse_op_preconditioned.cu`
     const int n = Xinv.Ncolor();
-    if (location == QUDA_CUDA_FIELD_LOCATION) {
+    {
       // FIXME: add support for double precision inverse
       // Reorder to MILC order for inversion, based on "coarse_op_preconditioned.cu"
       GaugeFieldParam param(Xinv);
@@ -335,15 +392,6 @@ namespace quda {
         delete Xinv_;
       }
 
-    } else if (location == QUDA_CPU_FIELD_LOCATION) {
-
-      if (Xinv.Precision() == QUDA_DOUBLE_PRECISION)
-        errorQuda("Unsupported precision %d", Xinv.Precision());
-
-      const cpuGaugeField *X_h = static_cast<const cpuGaugeField*>(X);
-      cpuGaugeField *Xinv_h = static_cast<cpuGaugeField*>(&Xinv);
-      blas::flops += invert((void*)Xinv_h->Gauge_p(), (void*)X_h->Gauge_p(), n, X_h->Volume(), X->Precision(), X->Location());
-
     }
 
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Xinv = %e\n", Xinv.norm2(0));
@@ -2,6 +2,7 @@
 #include <cuda_profiler_api.h>
 #include <util_quda.h>
 #include <quda_internal.h>
+#include <tune_quda.h>
 
 #ifdef QUDA_NVML
 #include <nvml.h>
@@ -218,6 +219,106 @@ namespace quda
       return max_shared_bytes;
     }
 
+    bool time_launch(Tunable &tunable, float &time, std::string &error)
+    {
+      cudaEvent_t start, end;
+      cudaEventCreate(&start);
+      cudaEventCreate(&end);
+
+      cudaDeviceSynchronize();
+      cudaGetLastError(); // clear error counter
+      tunable.apply(0); // do initial call in case we need to jit compile for these parameters or if policy tuning
+
+      cudaEventRecord(start, 0);
+      for (int i = 0; i < tunable.tuningIter(); i++) {
+        tunable.apply(0); // calls tuneLaunch() again, which simply returns the currently active param
+      }
+      cudaEventRecord(end, 0);
+      cudaEventSynchronize(end);
+      float elapsed_time;
+      cudaEventElapsedTime(&elapsed_time, start, end);
+      cudaDeviceSynchronize();
+      cudaError_t launch_error = cudaGetLastError();
+
+      { // check that error state is cleared
+        cudaDeviceSynchronize();
+        cudaError_t error = cudaGetLastError();
+        if (error != cudaSuccess) errorQuda("Failed to clear error state %s\n", cudaGetErrorString(error));
+      }
+
+      cudaEventDestroy(start);
+      cudaEventDestroy(end);
+
+      time = elapsed_time / (1e3 * tunable.tuningIter());
+
+      bool success = true;
+      if (tunable.jitifyError() != CUDA_SUCCESS) {
+        const char *str;
+        cuGetErrorString(tunable.jitifyError(), &str);
+        error = str;
+        success = false;
+      } else if (launch_error != cudaSuccess) {
+        error = cudaGetErrorString(launch_error);
+        success = false;
+      }
+      tunable.jitifyError() = CUDA_SUCCESS;
+      return success;
+    }
+
+    void *allocate(size_t size)
+    {
+      void *ptr;
+      return cudaMalloc(&ptr, size) == cudaSuccess ? ptr : nullptr;
+    }
+
+    void *allocate_peer(size_t size)
+    {
+      // cudaMalloc can be redirected (as is the case with QDPJIT), so use the driver API
+      void *ptr;
+      return cuMemAlloc((CUdeviceptr *)&ptr, size) == CUDA_SUCCESS ? ptr : nullptr;
+    }
+
+    void *allocate_managed(size_t size)
+    {
+      void *ptr;
+      return cudaMallocManaged(&ptr, size) == cudaSuccess ? ptr : nullptr;
+    }
+
+    bool release(void *ptr) { return cudaFree(ptr) == cudaSuccess; }
+
+    bool release_peer(void *ptr) { return cuMemFree((CUdeviceptr)ptr) == CUDA_SUCCESS; }
+
+    bool register_host(void *ptr, size_t size, bool mapped)
+    {
+      unsigned int flags = mapped ? cudaHostRegisterMapped | cudaHostRegisterPortable : cudaHostRegisterDefault;
+      return cudaHostRegister(ptr, size, flags) == cudaSuccess;
+    }
+
+    bool unregister_host(void *ptr) { return cudaHostUnregister(ptr) == cudaSuccess; }
+
+    QudaFieldLocation pointer_location(const void *ptr)
+    {
+      CUpointer_attribute attribute[] = {CU_POINTER_ATTRIBUTE_MEMORY_TYPE};
+      CUmemorytype mem_type;
+      void *data[] = {&mem_type};
+      CUresult error = cuPointerGetAttributes(1, attribute, data, reinterpret_cast<CUdeviceptr>(ptr));
+      if (error != CUDA_SUCCESS) {
+        const char *string;
+        cuGetErrorString(error, &string);
+        errorQuda("cuPointerGetAttributes failed with error %s", string);
+      }
+
+      // catch pointers that have not been created in CUDA
+      if (mem_type == 0) mem_type = CU_MEMORYTYPE_HOST;
+
+      switch (mem_type) {
+      case CU_MEMORYTYPE_DEVICE:
+      case CU_MEMORYTYPE_UNIFIED: return QUDA_CUDA_FIELD_LOCATION;
+      case CU_MEMORYTYPE_HOST: return QUDA_CPU_FIELD_LOCATION;
+      default: errorQuda("Unknown memory type %d", mem_type); return QUDA_INVALID_FIELD_LOCATION;
+      }
+    }
+
     namespace profile {
 
       void start()
@@ -233,4 +334,15 @@ namespace quda
     }
 
   }
+
+  void *get_mapped_device_pointer_(const char *func, const char *file, int line, const void *host)
+  {
+    void *device;
+    auto error = cudaHostGetDevicePointer(&device, const_cast<void *>(host), 0);
+    if (error != cudaSuccess) {
+      errorQuda("cudaHostGetDevicePointer failed with error %s (%s:%d in %s()",
+                cudaGetErrorString(error), file, line, func);
+    }
+    return device;
+  }
 }
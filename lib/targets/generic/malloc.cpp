@@ -5,6 +5,7 @@
 #include <unistd.h>   // for getpagesize()
 #include <execinfo.h> // for backtrace
 #include <quda_internal.h>
+#include <device.h>
 
 #ifdef USE_QDPJIT
 #include "qdp_quda.h"
@@ -136,7 +137,7 @@ namespace quda
   }
 
   /**
-   * Under CUDA 4.0, cudaHostRegister seems to require that both the
+   * Registering host memory with the device requires that both the
    * beginning and end of the buffer be aligned on page boundaries.
    * This local function takes care of the alignment and gets called
    * by pinned_malloc_() and mapped_malloc_()
@@ -147,17 +148,10 @@ namespace quda
 
     a.size = size;
 
-#if (CUDA_VERSION > 4000)                                                                                              \
-  && 0 // we need to manually align to page boundaries to allow us to bind a texture to mapped memory
-    a.base_size = size;
-    ptr = malloc(size);
-    if (!ptr) {
-#else
     static int page_size = 2 * getpagesize();
     a.base_size = ((size + page_size - 1) / page_size) * page_size; // round up to the nearest multiple of page_size
     int align = posix_memalign(&ptr, page_size, a.base_size);
     if (!ptr || align != 0) {
-#endif
       errorQuda("Failed to allocate aligned host memory of size %zu (%s:%d in %s())\n", size, a.file.c_str(), a.line,
                 a.func.c_str());
     }
@@ -172,7 +166,7 @@ namespace quda
     if (!init) {
       char *enable_managed_memory = getenv("QUDA_ENABLE_MANAGED_MEMORY");
       if (enable_managed_memory && strcmp(enable_managed_memory, "1") == 0) {
-        warningQuda("Using managed memory for CUDA allocations");
+        warningQuda("Using managed memory for device allocations");
         managed = true;
 
         if (deviceProp.major < 6) warningQuda("Using managed memory on pre-Pascal architecture is limited");
@@ -205,8 +199,7 @@ namespace quda
   }
 
   /**
-   * Perform a standard cudaMalloc() with error-checking.  This
-   * function should only be called via the device_malloc() macro,
+   * Allocate device memory with error-checking.  This function should only be called via the device_malloc() macro,
    * defined in malloc_quda.h
    */
   void *device_malloc_(const char *func, const char *file, int line, size_t size)
@@ -215,12 +208,10 @@ namespace quda
 
 #ifndef QDP_USE_CUDA_MANAGED_MEMORY
     MemAlloc a(func, file, line);
-    void *ptr;
-
     a.size = a.base_size = size;
 
-    cudaError_t err = cudaMalloc(&ptr, size);
-    if (err != cudaSuccess) {
+    void *ptr = device::allocate(size);
+    if (!ptr) {
       errorQuda("Failed to allocate device memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
     track_malloc(DEVICE, a, ptr);
@@ -235,9 +226,9 @@ namespace quda
   }
 
   /**
-   * Perform a cuMemAlloc with error-checking.  This function is to
+   * Allocate device memory with error-checking.  This function is to
    * guarantee a unique memory allocation on the device, since
-   * cudaMalloc can be redirected (as is the case with QDPJIT).  This
+   * device_malloc can be redirected (as is the case with QDPJIT).  This
    * should only be called via the device_pinned_malloc() macro,
    * defined in malloc_quda.h.
    */
@@ -246,12 +237,10 @@ namespace quda
     if (!comm_peer2peer_present()) return device_malloc_(func, file, line, size);
 
     MemAlloc a(func, file, line);
-    void *ptr;
-
     a.size = a.base_size = size;
 
-    CUresult err = cuMemAlloc((CUdeviceptr *)&ptr, size);
-    if (err != CUDA_SUCCESS) {
+    void *ptr = device::allocate_peer(size);
+    if (!ptr) {
       errorQuda("Failed to allocate device memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
     track_malloc(DEVICE_PINNED, a, ptr);
@@ -285,17 +274,17 @@ namespace quda
    * should only be called via the pinned_malloc() macro, defined in
    * malloc_quda.h
    *
-   * Note that we do not rely on cudaHostAlloc(), since buffers
-   * allocated in this way have been observed to cause problems when
-   * shared with MPI via GPU Direct on some systems.
+   * Note that we register memory we allocated ourselves rather than
+   * have the device runtime allocate it, since buffers allocated in
+   * this way have been observed to cause problems when shared with
+   * MPI via GPU Direct on some systems.
    */
   void *pinned_malloc_(const char *func, const char *file, int line, size_t size)
   {
     MemAlloc a(func, file, line);
     void *ptr = aligned_malloc(a, size);
 
-    cudaError_t err = cudaHostRegister(ptr, a.base_size, cudaHostRegisterDefault);
-    if (err != cudaSuccess) {
+    if (!device::register_host(ptr, a.base_size, false)) {
       errorQuda("Failed to register pinned memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
     track_malloc(PINNED, a, ptr);
@@ -313,23 +302,11 @@ namespace quda
   void *mapped_malloc_(const char *func, const char *file, int line, size_t size)
   {
     MemAlloc a(func, file, line);
-
-#if 0
-    void *ptr;
-    static int page_size = 2*getpagesize();
-    a.base_size = ((size + page_size - 1) / page_size) * page_size; // round up to the nearest multiple of page_size
-    a.size = size;
-    cudaError_t err = cudaHostAlloc(&ptr, a.base_size, cudaHostAllocMapped | cudaHostAllocPortable);
-    if (err != cudaSuccess) {
-      errorQuda("cudaHostAlloc failed of size %zu (%s:%d in %s())\n", size, file, line, func); }
-    }
-#else
     void *ptr = aligned_malloc(a, size);
-    cudaError_t err = cudaHostRegister(ptr, a.base_size, cudaHostRegisterMapped | cudaHostRegisterPortable);
-    if (err != cudaSuccess) {
+
+    if (!device::register_host(ptr, a.base_size, true)) {
       errorQuda("Failed to register host-mapped memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
-#endif
     track_malloc(MAPPED, a, ptr);
 #ifdef HOST_DEBUG
     memset(ptr, 0xff, a.base_size);
@@ -338,19 +315,16 @@ namespace quda
   }
 
   /**
-   * Perform a standard cudaMallocManaged() with error-checking.  This
-   * function should only be called via the managed_malloc() macro,
+   * Allocate managed memory with error-checking.  This function should only be called via the managed_malloc() macro,
    * defined in malloc_quda.h
    */
   void *managed_malloc_(const char *func, const char *file, int line, size_t size)
   {
     MemAlloc a(func, file, line);
-    void *ptr;
-
     a.size = a.base_size = size;
 
-    cudaError_t err = cudaMallocManaged(&ptr, size);
-    if (err != cudaSuccess) {
+    void *ptr = device::allocate_managed(size);
+    if (!ptr) {
       errorQuda("Failed to allocate managed memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
     track_malloc(MANAGED, a, ptr);
@@ -377,8 +351,7 @@ namespace quda
     if (!alloc[DEVICE].count(ptr)) {
       errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
     }
-    cudaError_t err = cudaFree(ptr);
-    if (err != cudaSuccess) { errorQuda("Failed to free device memory (%s:%d in %s())\n", file, line, func); }
+    if (!device::release(ptr)) { errorQuda("Failed to free device memory (%s:%d in %s())\n", file, line, func); }
     track_free(DEVICE, ptr);
 #else
     device_pinned_free_(func, file, line, ptr);
@@ -401,8 +374,7 @@ namespace quda
     if (!alloc[DEVICE_PINNED].count(ptr)) {
       errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
     }
-    CUresult err = cuMemFree((CUdeviceptr)ptr);
-    if (err != CUDA_SUCCESS) { printfQuda("Failed to free device memory (%s:%d in %s())\n", file, line, func); }
+    if (!device::release_peer(ptr)) { printfQuda("Failed to free device memory (%s:%d in %s())\n", file, line, func); }
     track_free(DEVICE_PINNED, ptr);
   }
 
@@ -417,8 +389,7 @@ namespace quda
     if (!alloc[MANAGED].count(ptr)) {
       errorQuda("Attempt to free invalid managed pointer (%s:%d in %s())\n", file, line, func);
     }
-    cudaError_t err = cudaFree(ptr);
-    if (err != cudaSuccess) { errorQuda("Failed to free device memory (%s:%d in %s())\n", file, line, func); }
+    if (!device::release(ptr)) { errorQuda("Failed to free device memory (%s:%d in %s())\n", file, line, func); }
     track_free(MANAGED, ptr);
   }
 
@@ -434,21 +405,16 @@ namespace quda
       track_free(HOST, ptr);
       free(ptr);
     } else if (alloc[PINNED].count(ptr)) {
-      cudaError_t err = cudaHostUnregister(ptr);
-      if (err != cudaSuccess) { errorQuda("Failed to unregister pinned memory (%s:%d in %s())\n", file, line, func); }
+      if (!device::unregister_host(ptr)) {
+        errorQuda("Failed to unregister pinned memory (%s:%d in %s())\n", file, line, func);
+      }
       track_free(PINNED, ptr);
       free(ptr);
     } else if (alloc[MAPPED].count(ptr)) {
-#ifdef HOST_ALLOC
-      cudaError_t err = cudaFreeHost(ptr);
-      if (err != cudaSuccess) { errorQuda("Failed to free host memory (%s:%d in %s())\n", file, line, func); }
-#else
-      cudaError_t err = cudaHostUnregister(ptr);
-      if (err != cudaSuccess) {
+      if (!device::unregister_host(ptr)) {
         errorQuda("Failed to unregister host-mapped memory (%s:%d in %s())\n", file, line, func);
       }
       free(ptr);
-#endif
       track_free(MAPPED, ptr);
     } else {
       printfQuda("ERROR: Attempt to free invalid host pointer (%s:%d in %s())\n", file, line, func);
@@ -482,41 +448,28 @@ namespace quda
     }
   }
 
-  QudaFieldLocation get_pointer_location(const void *ptr)
+  /**
+   * Return whether ptr lies within one of the allocations of the
+   * given type.
+   */
+  static bool contains(AllocType type, const void *ptr)
   {
-
-    CUpointer_attribute attribute[] = {CU_POINTER_ATTRIBUTE_MEMORY_TYPE};
-    CUmemorytype mem_type;
-    void *data[] = {&mem_type};
-    CUresult error = cuPointerGetAttributes(1, attribute, data, reinterpret_cast<CUdeviceptr>(ptr));
-    if (error != CUDA_SUCCESS) {
-      const char *string;
-      cuGetErrorString(error, &string);
-      errorQuda("cuPointerGetAttributes failed with error %s", string);
-    }
-
-    // catch pointers that have not been created in CUDA
-    if (mem_type == 0) mem_type = CU_MEMORYTYPE_HOST;
-
-    switch (mem_type) {
-    case CU_MEMORYTYPE_DEVICE:
-    case CU_MEMORYTYPE_UNIFIED: return QUDA_CUDA_FIELD_LOCATION;
-    case CU_MEMORYTYPE_HOST: return QUDA_CPU_FIELD_LOCATION;
-    default: errorQuda("Unknown memory type %d", mem_type); return QUDA_INVALID_FIELD_LOCATION;
-    }
+    auto it = alloc[type].upper_bound(const_cast<void *>(ptr));
+    if (it == alloc[type].begin()) return false;
+    --it;
+    return static_cast<const char *>(ptr) < static_cast<const char *>(it->first) + it->second.base_size;
   }
 
-  void *get_mapped_device_pointer_(const char *func, const char *file, int line, const void *host)
+  QudaFieldLocation get_pointer_location(const void *ptr)
   {
-    void *device;
-    auto error = cudaHostGetDevicePointer(&device, const_cast<void *>(host), 0);
-    if (error != cudaSuccess) {
-      errorQuda("cudaHostGetDevicePointer failed with error %s (%s:%d in %s()",
-                cudaGetErrorString(error), file, line, func);
-    }
-    return device;
-  }
+    QudaFieldLocation location = device::pointer_location(ptr);
+    if (location != QUDA_INVALID_FIELD_LOCATION) return location;
 
+    // the target cannot tell, so the location is where we allocated it
+    if (contains(DEVICE, ptr) || contains(DEVICE_PINNED, ptr) || contains(MANAGED, ptr))
+      return QUDA_CUDA_FIELD_LOCATION;
+    return QUDA_CPU_FIELD_LOCATION;
+  }
 
   namespace pool
   {
@@ -745,8 +745,6 @@ namespace quda
          can't guarantee that all nodes are partaking */
       if (comm_rank() == 0 || !commGlobalReduction() || policyTuning()) {
         TuneParam best_param;
-        cudaError_t error = cudaSuccess;
-        cudaEvent_t start, end;
         float elapsed_time, best_time;
         time_t now;
 
@@ -757,9 +755,6 @@ namespace quda
         if (verbosity >= QUDA_DEBUG_VERBOSE) printfQuda("PreTune %s\n", key.name);
         tunable.preTune();
 
-        cudaEventCreate(&start);
-        cudaEventCreate(&end);
-
         if (verbosity >= QUDA_DEBUG_VERBOSE) {
           printfQuda("Tuning %s with %s at vol=%s\n", key.name, key.aux, key.volume);
         }
@@ -769,55 +764,24 @@ namespace quda
 
         tunable.initTuneParam(param);
         while (tuning) {
-          cudaDeviceSynchronize();
-          cudaGetLastError(); // clear error counter
           tunable.checkLaunchParam(param);
           if (verbosity >= QUDA_DEBUG_VERBOSE) {
             printfQuda("About to call tunable.apply block=(%d,%d,%d) grid=(%d,%d,%d) shared_bytes=%d aux=(%d,%d,%d)\n",
                        param.block.x, param.block.y, param.block.z, param.grid.x, param.grid.y, param.grid.z,
                        param.shared_bytes, param.aux.x, param.aux.y, param.aux.z);
           }
-          tunable.apply(0); // do initial call in case we need to jit compile for these parameters or if policy tuning
 
-          cudaEventRecord(start, 0);
-          for (int i = 0; i < tunable.tuningIter(); i++) {
-            tunable.apply(0); // calls tuneLaunch() again, which simply returns the currently active param
-          }
-          cudaEventRecord(end, 0);
-          cudaEventSynchronize(end);
-          cudaEventElapsedTime(&elapsed_time, start, end);
-          cudaDeviceSynchronize();
-          error = cudaGetLastError();
-
-          { // check that error state is cleared
-            cudaDeviceSynchronize();
-            cudaError_t error = cudaGetLastError();
-            if (error != cudaSuccess) errorQuda("Failed to clear error state %s\n", cudaGetErrorString(error));
-          }
-
-          elapsed_time /= (1e3 * tunable.tuningIter());
-          if ((elapsed_time < best_time) && (error == cudaSuccess) && (tunable.jitifyError() == CUDA_SUCCESS)) {
+          std::string error;
+          bool success = device::time_launch(tunable, elapsed_time, error);
+          if (success && elapsed_time < best_time) {
             best_time = elapsed_time;
             best_param = param;
           }
           if ((verbosity >= QUDA_DEBUG_VERBOSE)) {
-            if (error == cudaSuccess && tunable.jitifyError() == CUDA_SUCCESS) {
-              printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(),
-                         tunable.perfString(elapsed_time).c_str());
-            } else {
-              if (tunable.jitifyError() == CUDA_SUCCESS) {
-                // if not jitify error must be regular error
-                printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(), cudaGetErrorString(error));
-              } else {
-                // else is a jitify error
-                const char *str;
-                cuGetErrorString(tunable.jitifyError(), &str);
-                printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(), str);
-              }
-            }
+            printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(),
+                       success ? tunable.perfString(elapsed_time).c_str() : error.c_str());
           }
           tuning = tunable.advanceTuneParam(param);
-          tunable.jitifyError() = CUDA_SUCCESS;
         }
 
         tune_timer.Stop(__func__, __FILE__, __LINE__);
@@ -835,9 +799,6 @@ namespace quda
         best_param.comment += ctime(&now); // includes a newline
         best_param.time = best_time;
 
-        cudaEventDestroy(start);
-        cudaEventDestroy(end);
-
         if (verbosity >= QUDA_DEBUG_VERBOSE) printfQuda("PostTune %s\n", key.name);
         tuning = true;
         tunable.postTune();
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
 #include <color_spinor_field.h>
 #include <qio_field.h>
 #include <vector_io.h>
@@ -6,10 +10,90 @@
 namespace quda
 {
 
-  VectorIO::VectorIO(const std::string &filename, bool parity_inflate) :
+#ifdef HAVE_QIO
+  namespace
+  {
+
+    /**
+       @brief Return the parameters of the host field that holds a
+       vector in the layout it has in the file: AoS order, at least
+       single precision, and inflated to a full field if requested.
+       @param[in] v Vector we are loading or saving
+       @param[in] parity_inflate Whether to inflate single parity fields
+       @param[in] create Field create type
+    */
+    ColorSpinorParam fileParam(const ColorSpinorField &v, bool parity_inflate, QudaFieldCreate create)
+    {
+      ColorSpinorParam param(v);
+      param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+      param.setPrecision(v.Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : v.Precision());
+      param.location = QUDA_CPU_FIELD_LOCATION;
+      param.create = create;
+      if (param.siteSubset == QUDA_PARITY_SITE_SUBSET && parity_inflate) {
+        param.x[0] *= 2;
+        param.siteSubset = QUDA_FULL_SITE_SUBSET;
+      }
+      return param;
+    }
+
+    void checkParity(QudaParity parity)
+    {
+      if (parity != QUDA_EVEN_PARITY && parity != QUDA_ODD_PARITY)
+        errorQuda("When loading or saving single parity vectors, the suggested parity must be set.");
+    }
+
+    /**
+       @brief Extract the suggested parity of an inflated full field
+       read from file.  Both are host fields in the file layout, so
+       this is a plain memory copy with no kernel launch, tuning or
+       pool allocation, and is safe to run on a helper thread.
+       @param[out] dst Single parity host vector
+       @param[in] src Full host vector in file layout
+       @param[in] parity Parity of the vector
+    */
+    void extractParity(ColorSpinorField &dst, const ColorSpinorField &src, QudaParity parity)
+    {
+      auto offset = parity == QUDA_ODD_PARITY ? dst.Bytes() : 0;
+      memcpy(dst.V(), static_cast<const char *>(src.V()) + offset, dst.Bytes());
+    }
+
+    /**
+       @brief Inflate a single parity host field into the suggested
+       parity of a full field in the file layout.  The other parity of
+       dst is left untouched, so should be zero.  As with
+       extractParity, this is safe to run on a helper thread.
+       @param[out] dst Full host vector in file layout
+       @param[in] src Single parity host vector
+       @param[in] parity Parity of the vector
+    */
+    void insertParity(ColorSpinorField &dst, const ColorSpinorField &src, QudaParity parity)
+    {
+      auto offset = parity == QUDA_ODD_PARITY ? src.Bytes() : 0;
+      memcpy(static_cast<char *>(dst.V()) + offset, src.V(), src.Bytes());
+    }
+
+    /**
+       @brief Set the QIO pointers to a set of vectors: since QIO
+       routines presently assume we have 4-d fields, each vector is
+       presented as Ls consecutive 4-d fields.
+    */
+    template <typename T> void setPointers(std::vector<void *> &V, const std::vector<T *> &v, int offset, int n, int Ls)
+    {
+      for (int i = 0; i < n; i++) {
+        auto stride = (v[offset + i]->Volume() / Ls) * v[offset + i]->Ncolor() * v[offset + i]->Nspin() * 2
+          * v[offset + i]->Precision();
+        for (int l = 0; l < Ls; l++) V[i * Ls + l] = static_cast<char *>(v[offset + i]->V()) + l * stride;
+      }
+    }
+
+  } // namespace
+#endif
+
+  VectorIO::VectorIO(const std::string &filename, bool parity_inflate, int chunk_size) :
 #ifdef HAVE_QIO
     filename(filename),
-    parity_inflate(parity_inflate)
+    parity_inflate(parity_inflate),
+    chunk_size(chunk_size)
 #else
     filename(filename)
 #endif
@@ -22,93 +106,87 @@ namespace quda
 #ifdef HAVE_QIO
     const int Nvec = vecs.size();
     auto spinor_parity = vecs[0]->SuggestedParity();
+    if (vecs[0]->Ndim() != 4 && vecs[0]->Ndim() != 5) errorQuda("Unexpected field dimension %d", vecs[0]->Ndim());
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Start loading %04d vectors from %s\n", Nvec, filename.c_str());
 
-    std::vector<ColorSpinorField *> tmp;
-    tmp.reserve(Nvec);
-    if (vecs[0]->Location() == QUDA_CUDA_FIELD_LOCATION) {
-      ColorSpinorParam csParam(*vecs[0]);
-      csParam.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
-      csParam.setPrecision(vecs[0]->Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : vecs[0]->Precision());
-      csParam.location = QUDA_CPU_FIELD_LOCATION;
-      csParam.create = QUDA_NULL_FIELD_CREATE;
-      if (csParam.siteSubset == QUDA_PARITY_SITE_SUBSET && parity_inflate) {
-        csParam.x[0] *= 2;
-        csParam.siteSubset = QUDA_FULL_SITE_SUBSET;
-      }
-      for (int i = 0; i < Nvec; i++) { tmp.push_back(ColorSpinorField::Create(csParam)); }
-    } else {
-      ColorSpinorParam csParam(*vecs[0]);
-      if (csParam.siteSubset == QUDA_PARITY_SITE_SUBSET && parity_inflate) {
-        csParam.x[0] *= 2;
-        csParam.siteSubset = QUDA_FULL_SITE_SUBSET;
-        for (int i = 0; i < Nvec; i++) { tmp.push_back(ColorSpinorField::Create(csParam)); }
-      } else {
-        for (int i = 0; i < Nvec; i++) { tmp.push_back(vecs[i]); }
-      }
-    }
+    ColorSpinorParam param = fileParam(*vecs[0], parity_inflate, QUDA_NULL_FIELD_CREATE);
+    const int Ls = vecs[0]->Ndim() == 5 ? param.x[4] : 1;
 
-    if (vecs[0]->Ndim() == 4 || vecs[0]->Ndim() == 5) {
-      // since QIO routines presently assume we have 4-d fields, we need to convert to array of 4-d fields
-      auto Ls = vecs[0]->Ndim() == 5 ? tmp[0]->X(4) : 1;
-      auto V4 = tmp[0]->Volume() / Ls;
-      auto stride = V4 * tmp[0]->Ncolor() * tmp[0]->Nspin() * 2 * tmp[0]->Precision();
-      void **V = static_cast<void **>(safe_malloc(Nvec * Ls * sizeof(void *)));
-      for (int i = 0; i < Nvec; i++) {
-        for (int j = 0; j < Ls; j++) { V[i * Ls + j] = static_cast<char *>(tmp[i]->V()) + j * stride; }
-      }
+    // host fields not being inflated are read into directly
+    const bool direct = vecs[0]->Location() == QUDA_CPU_FIELD_LOCATION && vecs[0]->SiteSubset() == param.siteSubset;
+    if (direct) param = ColorSpinorParam(*vecs[0]);
 
-      read_spinor_field(filename.c_str(), &V[0], tmp[0]->Precision(), tmp[0]->X(), tmp[0]->SiteSubset(), spinor_parity,
-                        tmp[0]->Ncolor(), tmp[0]->Nspin(), Nvec * Ls, 0, (char **)0);
+    void *reader = open_spinor_field_read(filename.c_str(), param.x, param.siteSubset);
 
-      host_free(V);
-    } else {
-      errorQuda("Unexpected field dimension %d", vecs[0]->Ndim());
+    // older files hold all vectors in a single record, else each vector is its own record
+    const int count = read_spinor_record_count(reader);
+    int per_record = 0;
+    if (count == Ls)
+      per_record = 1;
+    else if (count == Nvec * Ls)
+      per_record = Nvec;
+    else
+      errorQuda("File %s has records of %d fields, expected %d or %d", filename.c_str(), count, Ls, Nvec * Ls);
+    const int chunk = (per_record == Nvec || chunk_size <= 0) ? Nvec : std::min(chunk_size, Nvec);
+
+    /*
+      Vectors are read into file layout host buffers.  When inflated,
+      the parity extraction of chunk k runs on a helper thread while
+      the next chunk is read, so the file buffers are double buffered.
+      The helper thread only does host memory copies: the copies into
+      the destination vectors, which may launch kernels, are all done
+      on this thread.
+    */
+    const bool inflate = !direct && vecs[0]->SiteSubset() != param.siteSubset;
+    if (inflate) checkParity(spinor_parity);
+    std::vector<ColorSpinorField *> buffer[2], half;
+    if (!direct) {
+      for (int b = 0; b < (inflate && chunk < Nvec ? 2 : 1); b++)
+        for (int i = 0; i < chunk; i++) buffer[b].push_back(ColorSpinorField::Create(param));
+      if (inflate)
+        for (int i = 0; i < chunk; i++)
+          half.push_back(ColorSpinorField::Create(fileParam(*vecs[0], false, QUDA_NULL_FIELD_CREATE)));
     }
 
-    if (vecs[0]->Location() == QUDA_CUDA_FIELD_LOCATION) {
+    std::vector<void *> V(chunk * Ls);
+    std::thread reorder;
+    int i0_prev = 0, n_prev = 0;
+    auto finish = [&]() {
+      if (reorder.joinable()) reorder.join();
+      for (int i = 0; i < n_prev; i++) *vecs[i0_prev + i] = *half[i];
+      n_prev = 0;
+    };
 
-      ColorSpinorParam csParam(*vecs[0]);
-      if (csParam.siteSubset == QUDA_FULL_SITE_SUBSET || !parity_inflate) {
-        for (int i = 0; i < Nvec; i++) {
-          *vecs[i] = *tmp[i];
-          delete tmp[i];
-        }
-      } else {
-        // Create a temporary single-parity CPU field
-        csParam.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
-        csParam.setPrecision(vecs[0]->Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : vecs[0]->Precision());
-        csParam.location = QUDA_CPU_FIELD_LOCATION;
-        csParam.create = QUDA_NULL_FIELD_CREATE;
-
-        ColorSpinorField *tmp_intermediate = ColorSpinorField::Create(csParam);
-
-        for (int i = 0; i < Nvec; i++) {
-          if (spinor_parity == QUDA_EVEN_PARITY)
-            blas::copy(*tmp_intermediate, tmp[i]->Even());
-          else if (spinor_parity == QUDA_ODD_PARITY)
-            blas::copy(*tmp_intermediate, tmp[i]->Odd());
-          else
-            errorQuda("When loading single parity vectors, the suggested parity must be set.");
-
-          *vecs[i] = *tmp_intermediate;
-          delete tmp[i];
-        }
+    for (int i0 = 0, k = 0; i0 < Nvec; i0 += chunk, k++) {
+      const int n = std::min(chunk, Nvec - i0);
+      auto &buf = buffer[buffer[1].empty() ? 0 : k % 2];
+      if (direct)
+        setPointers(V, vecs, i0, n, Ls);
+      else
+        setPointers(V, buf, 0, n, Ls);
 
-        delete tmp_intermediate;
-      }
-    } else if (vecs[0]->Location() == QUDA_CPU_FIELD_LOCATION && vecs[0]->SiteSubset() == QUDA_PARITY_SITE_SUBSET) {
-      for (int i = 0; i < Nvec; i++) {
-        if (spinor_parity == QUDA_EVEN_PARITY)
-          blas::copy(*vecs[i], tmp[i]->Even());
-        else if (spinor_parity == QUDA_ODD_PARITY)
-          blas::copy(*vecs[i], tmp[i]->Odd());
-        else
-          errorQuda("When loading single parity vectors, the suggested parity must be set.");
-
-        delete tmp[i];
+      for (int i = 0; i < n; i += per_record)
+        read_spinor_record(reader, &V[i * Ls], param.Precision(), param.siteSubset, spinor_parity, param.nColor,
+                           param.nSpin, per_record * Ls);
+
+      if (inflate) {
+        finish();
+        reorder = std::thread([&buf, &half, n, spinor_parity]() {
+          for (int i = 0; i < n; i++) extractParity(*half[i], *buf[i], spinor_parity);
+        });
+        i0_prev = i0;
+        n_prev = n;
+      } else if (!direct) {
+        for (int i = 0; i < n; i++) *vecs[i0 + i] = *buf[i];
       }
     }
+    finish();
+
+    close_spinor_field_read(reader);
+
+    for (auto &b : buffer)
+      for (auto v : b) delete v;
+    for (auto v : half) delete v;
 
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done loading vectors\n");
 #else
@@ -120,93 +198,84 @@ namespace quda
   {
 #ifdef HAVE_QIO
     const int Nvec = vecs.size();
-    std::vector<ColorSpinorField *> tmp;
-    tmp.reserve(Nvec);
     auto spinor_parity = vecs[0]->SuggestedParity();
-    if (vecs[0]->Location() == QUDA_CUDA_FIELD_LOCATION) {
-      ColorSpinorParam csParam(*vecs[0]);
-      csParam.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
-      csParam.setPrecision(vecs[0]->Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : vecs[0]->Precision());
-      csParam.location = QUDA_CPU_FIELD_LOCATION;
-
-      if (csParam.siteSubset == QUDA_FULL_SITE_SUBSET || !parity_inflate) {
-        // We're good, copy as is.
-        csParam.create = QUDA_NULL_FIELD_CREATE;
-        for (int i = 0; i < Nvec; i++) {
-          tmp.push_back(ColorSpinorField::Create(csParam));
-          *tmp[i] = *vecs[i];
-        }
-      } else { // QUDA_PARITY_SITE_SUBSET
-        csParam.create = QUDA_NULL_FIELD_CREATE;
-
-        // intermediate host single-parity field
-        ColorSpinorField *tmp_intermediate = ColorSpinorField::Create(csParam);
-
-        csParam.x[0] *= 2;                          // corrects for the factor of two in the X direction
-        csParam.siteSubset = QUDA_FULL_SITE_SUBSET; // create a full-parity field.
-        csParam.create = QUDA_ZERO_FIELD_CREATE;    // to explicitly zero the odd sites.
-        for (int i = 0; i < Nvec; i++) {
-          tmp.push_back(ColorSpinorField::Create(csParam));
-
-          // copy the single parity eigen/singular vector into an
-          // intermediate device-side vector
-          *tmp_intermediate = *vecs[i];
-
-          // copy the single parity only eigen/singular vector into the even components of the full parity vector
-          if (spinor_parity == QUDA_EVEN_PARITY)
-            blas::copy(tmp[i]->Even(), *tmp_intermediate);
-          else if (spinor_parity == QUDA_ODD_PARITY)
-            blas::copy(tmp[i]->Odd(), *tmp_intermediate);
-          else
-            errorQuda("When saving single parity vectors, the suggested parity must be set.");
-        }
-        delete tmp_intermediate;
-      }
-    } else {
-      ColorSpinorParam csParam(*vecs[0]);
-      if (csParam.siteSubset == QUDA_PARITY_SITE_SUBSET && parity_inflate) {
-        csParam.x[0] *= 2;
-        csParam.siteSubset = QUDA_FULL_SITE_SUBSET;
-        csParam.create = QUDA_ZERO_FIELD_CREATE;
-        for (int i = 0; i < Nvec; i++) {
-          tmp.push_back(ColorSpinorField::Create(csParam));
-          if (spinor_parity == QUDA_EVEN_PARITY)
-            blas::copy(tmp[i]->Even(), *vecs[i]);
-          else if (spinor_parity == QUDA_ODD_PARITY)
-            blas::copy(tmp[i]->Odd(), *vecs[i]);
-          else
-            errorQuda("When saving single parity vectors, the suggested parity must be set.");
-        }
-      } else {
-        for (int i = 0; i < Nvec; i++) { tmp.push_back(vecs[i]); }
-      }
+    if (vecs[0]->Ndim() != 4 && vecs[0]->Ndim() != 5) errorQuda("Unexpected field dimension %d", vecs[0]->Ndim());
+
+    // zero create so that the other parity of an inflated field is zero
+    ColorSpinorParam param = fileParam(*vecs[0], parity_inflate, QUDA_ZERO_FIELD_CREATE);
+    const int Ls = vecs[0]->Ndim() == 5 ? param.x[4] : 1;
+
+    // host fields not being inflated are written from directly
+    const bool direct = vecs[0]->Location() == QUDA_CPU_FIELD_LOCATION && vecs[0]->SiteSubset() == param.siteSubset;
+    if (direct) param = ColorSpinorParam(*vecs[0]);
+
+    // when not streaming, write all vectors as a single record
+    const int chunk = chunk_size <= 0 ? Nvec : std::min(chunk_size, Nvec);
+    const int per_record = chunk_size <= 0 ? Nvec : 1;
+
+    /*
+      Vectors are copied into file layout host buffers on this thread.
+      When inflated, the parity insertion of chunk k runs on a helper
+      thread, doing host memory copies only, while chunk k - 1 is
+      written, so the file buffers are double buffered.
+    */
+    const bool inflate = !direct && vecs[0]->SiteSubset() != param.siteSubset;
+    if (inflate) checkParity(spinor_parity);
+    std::vector<ColorSpinorField *> buffer[2], half;
+    if (!direct) {
+      for (int b = 0; b < (inflate && chunk < Nvec ? 2 : 1); b++)
+        for (int i = 0; i < chunk; i++) buffer[b].push_back(ColorSpinorField::Create(param));
+      if (inflate)
+        for (int i = 0; i < chunk; i++)
+          half.push_back(ColorSpinorField::Create(fileParam(*vecs[0], false, QUDA_NULL_FIELD_CREATE)));
     }
 
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Start saving %d vectors to %s\n", Nvec, filename.c_str());
 
-    if (vecs[0]->Ndim() == 4 || vecs[0]->Ndim() == 5) {
-      // since QIO routines presently assume we have 4-d fields, we need to convert to array of 4-d fields
-      auto Ls = vecs[0]->Ndim() == 5 ? tmp[0]->X(4) : 1;
-      auto V4 = tmp[0]->Volume() / Ls;
-      auto stride = V4 * tmp[0]->Ncolor() * tmp[0]->Nspin() * 2 * tmp[0]->Precision();
-      void **V = static_cast<void **>(safe_malloc(Nvec * Ls * sizeof(void *)));
-      for (int i = 0; i < Nvec; i++) {
-        for (int j = 0; j < Ls; j++) { V[i * Ls + j] = static_cast<char *>(tmp[i]->V()) + j * stride; }
-      }
+    void *writer = open_spinor_field_write(filename.c_str(), param.x, param.siteSubset);
+
+    std::vector<void *> V(chunk * Ls);
+    auto write = [&](int i0, int k) {
+      const int n = std::min(chunk, Nvec - i0);
+      if (direct)
+        setPointers(V, vecs, i0, n, Ls);
+      else
+        setPointers(V, buffer[buffer[1].empty() ? 0 : k % 2], 0, n, Ls);
 
-      write_spinor_field(filename.c_str(), &V[0], tmp[0]->Precision(), tmp[0]->X(), tmp[0]->SiteSubset(), spinor_parity,
-                         tmp[0]->Ncolor(), tmp[0]->Nspin(), Nvec * Ls, 0, (char **)0);
+      for (int i = 0; i < n; i += per_record)
+        write_spinor_record(writer, &V[i * Ls], param.Precision(), param.siteSubset, spinor_parity, param.nColor,
+                            param.nSpin, per_record * Ls);
+    };
 
-      host_free(V);
+    if (inflate) {
+      std::thread reorder;
+      for (int i0 = 0, k = 0; i0 < Nvec + chunk; i0 += chunk, k++) {
+        if (i0 < Nvec) {
+          const int n = std::min(chunk, Nvec - i0);
+          for (int i = 0; i < n; i++) *half[i] = *vecs[i0 + i];
+          auto &buf = buffer[buffer[1].empty() ? 0 : k % 2];
+          reorder = std::thread([&buf, &half, n, spinor_parity]() {
+            for (int i = 0; i < n; i++) insertParity(*buf[i], *half[i], spinor_parity);
+          });
+        }
+        if (i0 > 0) write(i0 - chunk, k - 1);
+        if (reorder.joinable()) reorder.join();
+      }
     } else {
-      errorQuda("Unexpected field dimension %d", vecs[0]->Ndim());
+      for (int i0 = 0; i0 < Nvec; i0 += chunk) {
+        if (!direct)
+          for (int i = 0; i < std::min(chunk, Nvec - i0); i++) *buffer[0][i] = *vecs[i0 + i];
+        write(i0, 0);
+      }
     }
 
+    close_spinor_field_write(writer);
+
+    for (auto &b : buffer)
+      for (auto v : b) delete v;
+    for (auto v : half) delete v;
+
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done saving vectors\n");
-    if (vecs[0]->Location() == QUDA_CUDA_FIELD_LOCATION
-        || (vecs[0]->Location() == QUDA_CPU_FIELD_LOCATION && vecs[0]->SiteSubset() == QUDA_PARITY_SITE_SUBSET)) {
-      for (int i = 0; i < Nvec; i++) delete tmp[i];
-    }
 #else
     errorQuda("\nQIO library was not built.\n");
 #endif
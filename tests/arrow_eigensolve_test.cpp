@@ -0,0 +1,124 @@
+#include <random>
+#include <vector>
+
+#include <quda_internal.h>
+#include <eigensolve_quda.h>
+#include <eigen_helper.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Host tests of the divide and conquer eigensolver for the arrow
+   matrices of the thick restarted Lanczos method, checked against
+   the dense Eigen solver that TRLM uses with use_eigen_arrow.  The
+   matrices are assembled exactly as in TRLM::eigensolveFromArrowMat.
+*/
+
+using namespace quda;
+
+static std::mt19937 rng(1234);
+
+struct ArrowMatrix {
+  int arrow_pos;
+  std::vector<double> diag;
+  std::vector<double> off;
+};
+
+static ArrowMatrix random_arrow(int n, int arrow_pos)
+{
+  std::normal_distribution<double> normal(0.0, 1.0);
+  ArrowMatrix m {arrow_pos, std::vector<double>(n), std::vector<double>(n - 1)};
+  for (auto &a : m.diag) a = normal(rng);
+  for (auto &b : m.off) b = normal(rng);
+  return m;
+}
+
+static MatrixXd dense(const ArrowMatrix &m)
+{
+  const int n = m.diag.size();
+  MatrixXd A = MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; i++) A(i, i) = m.diag[i];
+  for (int i = 0; i < m.arrow_pos; i++) A(i, m.arrow_pos) = A(m.arrow_pos, i) = m.off[i];
+  for (int i = m.arrow_pos; i < n - 1; i++) A(i, i + 1) = A(i + 1, i) = m.off[i];
+  return A;
+}
+
+/**
+   Compare the eigenpairs with the dense solver: the eigenvalues
+   directly, every pair by its residual and the orthogonality of the
+   eigenvectors, and the eigenvectors of well separated eigenvalues
+   directly up to sign.
+*/
+static void check(const ArrowMatrix &m)
+{
+  const int n = m.diag.size();
+  MatrixXd A = dense(m);
+  SelfAdjointEigenSolver<MatrixXd> eigensolver(A);
+  const VectorXd &lambda = eigensolver.eigenvalues();
+  const MatrixXd &U = eigensolver.eigenvectors();
+
+  std::vector<double> evals, evecs;
+  arrowEigensolve(m.arrow_pos, m.diag, m.off, evals, evecs);
+  ASSERT_EQ((int)evals.size(), n);
+  ASSERT_EQ((int)evecs.size(), n * n);
+
+  MatrixXd V(n, n);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++) V(j, i) = evecs[n * i + j];
+
+  const double norm = A.norm();
+  const double tol = 1e-12 * n;
+
+  for (int i = 0; i < n; i++) EXPECT_NEAR(evals[i], lambda[i], tol * norm) << "eigenvalue " << i;
+
+  for (int i = 0; i < n; i++) {
+    VectorXd r = A * V.col(i) - evals[i] * V.col(i);
+    EXPECT_LT(r.norm(), tol * norm) << "residual of eigenpair " << i;
+  }
+
+  EXPECT_LT((V.transpose() * V - MatrixXd::Identity(n, n)).norm(), tol);
+
+  for (int i = 0; i < n; i++) {
+    double gap = std::numeric_limits<double>::max();
+    if (i > 0) gap = std::min(gap, lambda[i] - lambda[i - 1]);
+    if (i < n - 1) gap = std::min(gap, lambda[i + 1] - lambda[i]);
+    if (gap < 1e-6 * norm) continue;
+    EXPECT_NEAR(std::abs(V.col(i).dot(U.col(i))), 1.0, tol * norm / gap) << "eigenvector " << i;
+  }
+}
+
+// below the dense cutoff, so the dense fallback
+TEST(ArrowEigensolve, small)
+{
+  check(random_arrow(12, 5));
+}
+
+// the pure tridiagonal matrix of the first restart
+TEST(ArrowEigensolve, tridiagonal)
+{
+  check(random_arrow(200, 0));
+}
+
+TEST(ArrowEigensolve, arrow)
+{
+  check(random_arrow(64, 20));
+  check(random_arrow(300, 150));
+  check(random_arrow(257, 256));
+}
+
+// converged Ritz pairs give near degenerate diagonals with tiny couplings, which must be deflated
+TEST(ArrowEigensolve, deflation)
+{
+  ArrowMatrix m = random_arrow(128, 48);
+  for (int i = 0; i < 16; i++) {
+    m.diag[i + 16] = m.diag[i];
+    m.off[i] *= 1e-14;
+  }
+  check(m);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -50,6 +50,9 @@ std::vector<cpuColorSpinorField*> zmH;
 int Nspin;
 int Ncolor;
 
+// whether to benchmark the host (CPU field) implementations
+bool host_benchmark = false;
+
 void setPrec(ColorSpinorParam &param, QudaPrecision precision) { param.setPrecision(precision, precision, true); }
 
 void display_test_info()
@@ -546,6 +549,138 @@ double benchmark(Kernel kernel, const int niter)
 
 #define ERROR(a) fabs(blas::norm2(*a##D) - blas::norm2(*a##H)) / blas::norm2(*a##H)
 
+/**
+   Benchmark the host implementation of a kernel on the CPU fields.
+   Returns a negative time if the kernel has no host implementation
+   exercised here.
+*/
+double benchmark_host(Kernel kernel, const int niter)
+{
+  double a = 1.0, b = 2.0, c = 3.0;
+  quda::Complex a2(1.0, 0.5), b2(2.0, -0.5);
+
+  stopwatchStart();
+
+  switch (kernel) {
+
+  case Kernel::axpbyz:
+    for (int i = 0; i < niter; ++i) blas::axpbyz(a, *xH, b, *yH, *zH);
+    break;
+
+  case Kernel::ax:
+    for (int i = 0; i < niter; ++i) blas::ax(a, *xH);
+    break;
+
+  case Kernel::caxpy:
+    for (int i = 0; i < niter; ++i) blas::caxpy(a2, *xH, *yH);
+    break;
+
+  case Kernel::caxpby:
+    for (int i = 0; i < niter; ++i) blas::caxpby(a2, *xH, b2, *yH);
+    break;
+
+  case Kernel::cxpaypbz:
+    for (int i = 0; i < niter; ++i) blas::cxpaypbz(*xH, a2, *yH, b2, *zH);
+    break;
+
+  case Kernel::axpyBzpcx:
+    for (int i = 0; i < niter; ++i) blas::axpyBzpcx(a, *xH, *yH, b, *zH, c);
+    break;
+
+  case Kernel::axpyZpbx:
+    for (int i = 0; i < niter; ++i) blas::axpyZpbx(a, *xH, *yH, *zH, b);
+    break;
+
+  case Kernel::caxpbypzYmbw:
+    for (int i = 0; i < niter; ++i) blas::caxpbypzYmbw(a2, *xH, b2, *yH, *zH, *wH);
+    break;
+
+  case Kernel::cabxpyAx:
+    for (int i = 0; i < niter; ++i) blas::cabxpyAx(a, b2, *xH, *yH);
+    break;
+
+  case Kernel::caxpyXmaz:
+    for (int i = 0; i < niter; ++i) blas::caxpyXmaz(a2, *xH, *yH, *zH);
+    break;
+
+  case Kernel::norm2:
+    for (int i = 0; i < niter; ++i) blas::norm2(*xH);
+    break;
+
+  case Kernel::reDotProduct:
+    for (int i = 0; i < niter; ++i) blas::reDotProduct(*xH, *yH);
+    break;
+
+  case Kernel::axpbyzNorm:
+    for (int i = 0; i < niter; ++i) blas::axpbyzNorm(a, *xH, b, *yH, *zH);
+    break;
+
+  case Kernel::axpyCGNorm:
+    for (int i = 0; i < niter; ++i) blas::axpyCGNorm(a, *xH, *yH);
+    break;
+
+  case Kernel::caxpyNorm:
+    for (int i = 0; i < niter; ++i) blas::caxpyNorm(a2, *xH, *yH);
+    break;
+
+  case Kernel::caxpyXmazNormX:
+    for (int i = 0; i < niter; ++i) blas::caxpyXmazNormX(a2, *xH, *yH, *zH);
+    break;
+
+  case Kernel::cabxpyzAxNorm:
+    for (int i = 0; i < niter; ++i) blas::cabxpyzAxNorm(a, b2, *xH, *yH, *yH);
+    break;
+
+  case Kernel::cDotProduct:
+    for (int i = 0; i < niter; ++i) blas::cDotProduct(*xH, *yH);
+    break;
+
+  case Kernel::caxpyDotzy:
+    for (int i = 0; i < niter; ++i) blas::caxpyDotzy(a2, *xH, *yH, *zH);
+    break;
+
+  case Kernel::cDotProductNormA:
+    for (int i = 0; i < niter; ++i) blas::cDotProductNormA(*xH, *yH);
+    break;
+
+  case Kernel::caxpbypzYmbwcDotProductUYNormY:
+    for (int i = 0; i < niter; ++i) blas::caxpbypzYmbwcDotProductUYNormY(a2, *xH, b2, *yH, *zH, *wH, *vH);
+    break;
+
+  case Kernel::HeavyQuarkResidualNorm:
+    for (int i = 0; i < niter; ++i) blas::HeavyQuarkResidualNorm(*xH, *yH);
+    break;
+
+  case Kernel::xpyHeavyQuarkResidualNorm:
+    for (int i = 0; i < niter; ++i) blas::xpyHeavyQuarkResidualNorm(*xH, *yH, *zH);
+    break;
+
+  case Kernel::tripleCGReduction:
+    for (int i = 0; i < niter; ++i) blas::tripleCGReduction(*xH, *yH, *zH);
+    break;
+
+  case Kernel::tripleCGUpdate:
+    for (int i = 0; i < niter; ++i) blas::tripleCGUpdate(a, b, *xH, *yH, *zH, *wH);
+    break;
+
+  case Kernel::axpyReDot:
+    for (int i = 0; i < niter; ++i) blas::axpyReDot(a, *xH, *yH);
+    break;
+
+  case Kernel::caxpyBxpz:
+    for (int i = 0; i < niter; ++i) blas::caxpyBxpz(a2, *xH, *yH, b2, *zH);
+    break;
+
+  case Kernel::caxpyBzpx:
+    for (int i = 0; i < niter; ++i) blas::caxpyBzpx(a2, *xH, *yH, b2, *zH);
+    break;
+
+  default: return -1.0;
+  }
+
+  return stopwatchReadSeconds();
+}
+
 double test(Kernel kernel)
 {
   double a = M_PI, b = M_PI*exp(1.0), c = sqrt(M_PI);
@@ -1003,6 +1138,8 @@ int main(int argc, char** argv)
   // add_multigrid_option_group(app);
 
   app->add_option("--test", test_type, "Kernel to test (-1: -> all kernels)")->check(CLI::Range(0, Nkernels - 1));
+  app->add_option("--host-benchmark", host_benchmark,
+                  "Also benchmark the host implementations on the (double precision) CPU fields (default false)");
   try {
     app->parse(argc, argv);
   } catch (const CLI::ParseError &e) {
@@ -1128,6 +1265,30 @@ TEST_P(BlasTest, benchmark) {
   printfQuda("%-31s: Gflop/s = %6.1f, GB/s = %6.1f\n", kernel_map.at(kernel).c_str(), gflops, gbytes);
 }
 
+TEST_P(BlasTest, host_benchmark)
+{
+  prec_pair_t prec_pair = prec_idx_map(::testing::get<0>(GetParam()));
+  Kernel kernel = (Kernel)::testing::get<1>(GetParam());
+
+  // the host fields are always double precision
+  if (!host_benchmark || skip_kernel(prec_pair, kernel)) GTEST_SKIP();
+  if (prec_pair.first != QUDA_DOUBLE_PRECISION || prec_pair.second != QUDA_DOUBLE_PRECISION) GTEST_SKIP();
+
+  // warm up, and check we have a host implementation of this kernel
+  if (benchmark_host(kernel, 1) < 0.0) GTEST_SKIP();
+
+  quda::blas::flops = 0;
+  quda::blas::bytes = 0;
+
+  double secs = benchmark_host(kernel, niter);
+
+  double gflops = (quda::blas::flops * 1e-9) / (secs);
+  double gbytes = quda::blas::bytes / (secs * 1e9);
+  RecordProperty("Gflops", std::to_string(gflops));
+  RecordProperty("GBs", std::to_string(gbytes));
+  printfQuda("%-31s: host Gflop/s = %6.1f, GB/s = %6.1f\n", kernel_map.at(kernel).c_str(), gflops, gbytes);
+}
+
 std::string getblasname(testing::TestParamInfo<::testing::tuple<int, int>> param)
 {
   prec_pair_t prec_pair = prec_idx_map(::testing::get<0>(param.param));
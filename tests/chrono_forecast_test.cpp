@@ -0,0 +1,222 @@
+#include <random>
+#include <vector>
+
+#include <quda_internal.h>
+#include <chrono_forecast.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Host tests of the dense algebra behind the chronological forecast:
+   the incrementally updated Cholesky factor of the basis metric and
+   the projection of the operator onto the implicitly orthonormalized
+   basis.  The basis vectors and operator are small random dense
+   matrices, against which the results are checked directly.
+*/
+
+using namespace quda;
+
+using cvector = std::vector<Complex>;
+
+static std::mt19937 rng(1234);
+
+static Complex random_complex()
+{
+  std::normal_distribution<double> normal(0.0, 1.0);
+  double re = normal(rng);
+  double im = normal(rng);
+  return Complex(re, im);
+}
+
+// random length x n matrix, stored column major so each column is a basis vector
+static cvector random_basis(int length, int n)
+{
+  cvector V(length * n);
+  for (auto &v : V) v = random_complex();
+  return V;
+}
+
+// G_ij = (v_i, v_j)
+static cvector gram(const cvector &V, int length, int n)
+{
+  cvector G(n * n);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++) {
+      Complex sum = 0.0;
+      for (int s = 0; s < length; s++) sum += std::conj(V[i * length + s]) * V[j * length + s];
+      G[i * n + j] = sum;
+    }
+  return G;
+}
+
+// Hermitian positive definite length x length operator A = B^dag B + I
+static cvector random_hpd(int length)
+{
+  cvector B = random_basis(length, length), A(length * length);
+  for (int i = 0; i < length; i++)
+    for (int j = 0; j < length; j++) {
+      Complex sum = i == j ? 1.0 : 0.0;
+      for (int s = 0; s < length; s++) sum += std::conj(B[s * length + i]) * B[s * length + j];
+      A[i * length + j] = sum;
+    }
+  return A;
+}
+
+static cvector apply(const cvector &A, const Complex *v, int length)
+{
+  cvector y(length);
+  for (int i = 0; i < length; i++)
+    for (int j = 0; j < length; j++) y[i] += A[i * length + j] * v[j];
+  return y;
+}
+
+static double max_diff(const cvector &a, const cvector &b)
+{
+  double diff = 0.0;
+  for (unsigned int i = 0; i < a.size(); i++) diff = std::max(diff, std::abs(a[i] - b[i]));
+  return diff;
+}
+
+TEST(GramCholesky, solve)
+{
+  const int length = 32, n = 8;
+  cvector V = random_basis(length, n);
+  cvector G = gram(V, length, n);
+
+  GramCholesky chol(n);
+  chol.assign(n, G.data());
+  cvector x(n), b(n);
+  for (auto &bi : b) bi = random_complex();
+  chol.solve(x.data(), b.data());
+
+  for (int i = 0; i < n; i++) {
+    Complex sum = 0.0;
+    for (int j = 0; j < n; j++) sum += G[i * n + j] * x[j];
+    EXPECT_NEAR(std::abs(sum - b[i]), 0.0, 1e-10);
+  }
+}
+
+TEST(GramCholesky, update)
+{
+  const int length = 32, n = 8;
+  cvector V = random_basis(length, n);
+
+  // build the factor one row at a time, as new vectors arrive
+  GramCholesky incremental(n);
+  for (int k = 0; k < n; k++) {
+    incremental.resize(k + 1);
+    cvector G = gram(V, length, k + 1);
+    incremental.update(k, G.data() + k * (k + 1));
+  }
+
+  // then replace a vector in the middle of the basis
+  const int k = n / 2;
+  for (int s = 0; s < length; s++) V[k * length + s] = random_complex();
+  cvector G = gram(V, length, n);
+  incremental.update(k, G.data() + k * n);
+
+  GramCholesky full(n);
+  full.assign(n, G.data());
+
+  cvector b(n), x_inc(n), x_full(n);
+  for (auto &bi : b) bi = random_complex();
+  incremental.solve(x_inc.data(), b.data());
+  full.solve(x_full.data(), b.data());
+  EXPECT_LT(max_diff(x_inc, x_full), 1e-10);
+}
+
+TEST(GramCholesky, dependent)
+{
+  const int length = 32, n = 4;
+  cvector V = random_basis(length, n);
+  // make vector 2 a combination of vectors 0 and 1
+  for (int s = 0; s < length; s++) V[2 * length + s] = 2.0 * V[s] - Complex(0.0, 1.0) * V[length + s];
+  cvector G = gram(V, length, n);
+
+  GramCholesky chol(n);
+  chol.assign(n, G.data());
+  EXPECT_TRUE(chol.isActive(0));
+  EXPECT_TRUE(chol.isActive(1));
+  EXPECT_FALSE(chol.isActive(2));
+  EXPECT_TRUE(chol.isActive(3));
+
+  cvector b(n), x(n);
+  for (auto &bi : b) bi = random_complex();
+  chol.solve(x.data(), b.data());
+  EXPECT_EQ(x[2], Complex(0.0));
+}
+
+// check the projection against the Galerkin solution V^dag A V a = V^dag b
+TEST(ChronoProjection, hermitian)
+{
+  const int length = 24, n = 6;
+  cvector V = random_basis(length, n);
+  cvector A = random_hpd(length);
+  cvector b(length);
+  for (auto &bi : b) bi = random_complex();
+
+  std::vector<cvector> AV(n);
+  for (int j = 0; j < n; j++) AV[j] = apply(A, V.data() + j * length, length);
+
+  cvector H(n * n), phi(n);
+  for (int i = 0; i < n; i++) {
+    for (int s = 0; s < length; s++) phi[i] += std::conj(V[i * length + s]) * b[s];
+    for (int j = 0; j < n; j++)
+      for (int s = 0; s < length; s++) H[i * n + j] += std::conj(V[i * length + s]) * AV[j][s];
+  }
+
+  cvector G = gram(V, length, n);
+  GramCholesky metric(n);
+  metric.assign(n, G.data());
+  cvector a(n);
+  chronoProjection(a.data(), metric, H.data(), phi.data());
+
+  GramCholesky direct(n);
+  direct.assign(n, H.data());
+  cvector a_direct(n);
+  direct.solve(a_direct.data(), phi.data());
+
+  EXPECT_LT(max_diff(a, a_direct), 1e-10);
+}
+
+// the normal equations (A v_i, A v_j) a_j = (A v_i, b) give the minimum residual guess
+TEST(ChronoProjection, normal)
+{
+  const int length = 24, n = 6;
+  cvector V = random_basis(length, n);
+  cvector A = random_basis(length, length); // not Hermitian
+  cvector b(length);
+  for (auto &bi : b) bi = random_complex();
+
+  std::vector<cvector> AV(n);
+  for (int j = 0; j < n; j++) AV[j] = apply(A, V.data() + j * length, length);
+
+  cvector H(n * n), phi(n);
+  for (int i = 0; i < n; i++) {
+    for (int s = 0; s < length; s++) phi[i] += std::conj(AV[i][s]) * b[s];
+    for (int j = 0; j < n; j++)
+      for (int s = 0; s < length; s++) H[i * n + j] += std::conj(AV[i][s]) * AV[j][s];
+  }
+
+  cvector G = gram(V, length, n);
+  GramCholesky metric(n);
+  metric.assign(n, G.data());
+  cvector a(n);
+  chronoProjection(a.data(), metric, H.data(), phi.data());
+
+  // the residual must be orthogonal to the span of the A v_i
+  cvector r(b);
+  for (int j = 0; j < n; j++)
+    for (int s = 0; s < length; s++) r[s] -= a[j] * AV[j][s];
+  for (int i = 0; i < n; i++) {
+    Complex dot = 0.0;
+    for (int s = 0; s < length; s++) dot += std::conj(AV[i][s]) * r[s];
+    EXPECT_NEAR(std::abs(dot), 0.0, 1e-9);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+/**
+   Host-side multi-rank ping benchmark for the halo message path.
+   Each iteration mimics a ghost exchange: persistent send and
+   receive handles are declared in both directions of every
+   partitioned dimension, started, waited on and freed.  This is
+   timed with plain (uncached) buffers and again with the buffers
+   registered with the message handle cache, so the difference
+   measures the per-exchange setup cost that the cache removes.
+*/
+
+using namespace quda;
+
+double ping(size_t bytes, int niter, bool cached)
+{
+  const int nDim = 4;
+  void *send[nDim][2];
+  void *recv[nDim][2];
+
+  for (int d = 0; d < nDim; d++) {
+    for (int dir = 0; dir < 2; dir++) {
+      send[d][dir] = safe_malloc(bytes);
+      recv[d][dir] = safe_malloc(bytes);
+      memset(send[d][dir], 0, bytes);
+      if (cached) {
+        comm_handle_cache_register(send[d][dir], bytes);
+        comm_handle_cache_register(recv[d][dir], bytes);
+      }
+    }
+  }
+
+  MsgHandle *mh_send[nDim][2];
+  MsgHandle *mh_recv[nDim][2];
+
+  comm_barrier();
+  stopwatchStart();
+
+  for (int i = 0; i < niter; i++) {
+    for (int d = 0; d < nDim; d++) {
+      if (!comm_dim_partitioned(d)) continue;
+      mh_recv[d][0] = comm_declare_receive_relative(recv[d][0], d, -1, bytes);
+      mh_recv[d][1] = comm_declare_receive_relative(recv[d][1], d, +1, bytes);
+      mh_send[d][0] = comm_declare_send_relative(send[d][0], d, -1, bytes);
+      mh_send[d][1] = comm_declare_send_relative(send[d][1], d, +1, bytes);
+    }
+
+    for (int d = 0; d < nDim; d++) {
+      if (!comm_dim_partitioned(d)) continue;
+      for (int dir = 0; dir < 2; dir++) comm_start(mh_recv[d][dir]);
+      for (int dir = 0; dir < 2; dir++) comm_start(mh_send[d][dir]);
+    }
+
+    for (int d = 0; d < nDim; d++) {
+      if (!comm_dim_partitioned(d)) continue;
+      for (int dir = 0; dir < 2; dir++) {
+        comm_wait(mh_send[d][dir]);
+        comm_wait(mh_recv[d][dir]);
+        comm_free(mh_send[d][dir]);
+        comm_free(mh_recv[d][dir]);
+      }
+    }
+  }
+
+  double secs = stopwatchReadSeconds();
+  comm_allreduce_max(&secs);
+
+  for (int d = 0; d < nDim; d++) {
+    for (int dir = 0; dir < 2; dir++) {
+      if (cached) {
+        comm_handle_cache_invalidate(send[d][dir]);
+        comm_handle_cache_invalidate(recv[d][dir]);
+      }
+      host_free(send[d][dir]);
+      host_free(recv[d][dir]);
+    }
+  }
+
+  return secs;
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  if (!comm_partitioned()) warningQuda("No dimensions are partitioned: no messages will be exchanged");
+
+  printfQuda("Grid partition info:     X  Y  Z  T\n");
+  printfQuda("                         %d  %d  %d  %d\n", dimPartitioned(0), dimPartitioned(1), dimPartitioned(2),
+             dimPartitioned(3));
+  printfQuda("%12s %16s %16s %10s\n", "bytes", "uncached (us)", "cached (us)", "speedup");
+
+  for (size_t bytes = 8; bytes <= (1 << 22); bytes *= 4) {
+    ping(bytes, 10, true); // warm up
+    double uncached = ping(bytes, niter, false);
+    double cached = ping(bytes, niter, true);
+    printfQuda("%12lu %16.3f %16.3f %10.2f\n", bytes, 1e6 * uncached / niter, 1e6 * cached / niter,
+               uncached / cached);
+  }
+
+  finalizeComms();
+  return 0;
+}
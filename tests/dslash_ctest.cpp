@@ -140,6 +140,9 @@ void init(int precision, QudaReconstructType link_recon)
 
   if (inv_param.cpu_prec != gauge_param.cpu_prec) errorQuda("Gauge and spinor CPU precisions must match");
 
+  // the unpreconditioned operators act on full fields
+  const bool full_field = dtest_type == dslash_test_type::Mat || dtest_type == dslash_test_type::MatDagMat;
+
   // construct input fields
   for (int dir = 0; dir < 4; dir++) hostGauge[dir] = malloc((size_t)V * gauge_site_size * gauge_param.cpu_prec);
 
@@ -180,7 +183,7 @@ void init(int precision, QudaReconstructType link_recon)
     csParam.siteSubset = QUDA_PARITY_SITE_SUBSET;
     csParam.x[0] /= 2;
   } else {
-    if (test_type < 2 || test_type == 3) {
+    if (!full_field) {
       csParam.siteSubset = QUDA_PARITY_SITE_SUBSET;
       csParam.x[0] /= 2;
     } else {
@@ -225,7 +228,7 @@ void init(int precision, QudaReconstructType link_recon)
       csParam.siteSubset = QUDA_PARITY_SITE_SUBSET;
       csParam.x[0] /= 2;
     } else {
-      if (test_type < 2 || test_type == 3) {
+      if (!full_field) {
         csParam.siteSubset = QUDA_PARITY_SITE_SUBSET;
         csParam.x[0] /= 2;
       }
@@ -239,7 +242,7 @@ void init(int precision, QudaReconstructType link_recon)
     tmp1 = new cudaColorSpinorField(csParam);
 
     if (dslash_type != QUDA_DOMAIN_WALL_4D_DSLASH && dslash_type != QUDA_MOBIUS_DWF_DSLASH)
-      if (test_type == 2 || test_type == 4) csParam.x[0] /= 2;
+      if (full_field) csParam.x[0] /= 2;
 
     csParam.siteSubset = QUDA_PARITY_SITE_SUBSET;
     tmp2 = new cudaColorSpinorField(csParam);
@@ -1096,6 +1099,75 @@ TEST_P(DslashTest, verify)
   ASSERT_LE(deviation, tol) << "CPU and CUDA implementations do not agree";
 }
 
+/**
+   Apply the operator under test to host fields with the host Wilson
+   and clover implementations and check it against the reference.
+   The host operators work in the UKQCD basis, so the source and the
+   result are rotated to and from the basis of the reference.
+*/
+TEST_P(DslashTest, host)
+{
+  if (dslash_type != QUDA_WILSON_DSLASH && dslash_type != QUDA_CLOVER_WILSON_DSLASH) GTEST_SKIP();
+  // the host operator does not depend on the device precision or reconstruct, so only test it once
+  if (getPrecision(::testing::get<0>(GetParam())) != inv_param.cpu_prec
+      || ::testing::get<1>(GetParam()) != QUDA_RECONSTRUCT_NO)
+    GTEST_SKIP();
+
+  dslashRef();
+
+  GaugeFieldParam gParam(hostGauge, gauge_param);
+  gParam.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
+  cpuGaugeField U(gParam);
+  U.exchangeGhost();
+
+  cpuCloverField *A = nullptr;
+  if (dslash_type == QUDA_CLOVER_WILSON_DSLASH) {
+    CloverFieldParam cParam;
+    cParam.nDim = 4;
+    for (int d = 0; d < 4; d++) cParam.x[d] = gauge_param.X[d];
+    cParam.siteSubset = QUDA_FULL_SITE_SUBSET;
+    cParam.pad = 0;
+    cParam.csw = inv_param.clover_coeff;
+    cParam.order = inv_param.clover_order;
+    cParam.setPrecision(inv_param.clover_cpu_prec);
+    cParam.clover = hostClover;
+    cParam.cloverInv = hostCloverInv;
+    cParam.create = QUDA_REFERENCE_FIELD_CREATE;
+    A = new cpuCloverField(cParam);
+  }
+
+  bool pc = (dtest_type != dslash_test_type::Mat && dtest_type != dslash_test_type::MatDagMat);
+  DiracParam diracParam;
+  setDiracParam(diracParam, &inv_param, pc);
+  diracParam.gauge_h = &U;
+  diracParam.clover_h = A;
+  Dirac *host_dirac = Dirac::create(diracParam);
+
+  ColorSpinorParam param(*spinor);
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  param.gammaBasis = QUDA_UKQCD_GAMMA_BASIS;
+  cpuColorSpinorField in(param), out(param);
+  copyGenericColorSpinor(in, *spinor, QUDA_CPU_FIELD_LOCATION);
+
+  switch (dtest_type) {
+  case dslash_test_type::Dslash: host_dirac->Dslash(out, in, parity); break;
+  case dslash_test_type::MatPC:
+  case dslash_test_type::Mat: host_dirac->M(out, in); break;
+  case dslash_test_type::MatPCDagMatPC:
+  case dslash_test_type::MatDagMat: host_dirac->MdagM(out, in); break;
+  default: errorQuda("Test type %s not supported on host", get_string(dtest_type_map, dtest_type).c_str());
+  }
+
+  copyGenericColorSpinor(*spinorOut, out, QUDA_CPU_FIELD_LOCATION);
+
+  double deviation = pow(10, -(double)(cpuColorSpinorField::Compare(*spinorRef, *spinorOut)));
+
+  delete host_dirac;
+  if (A) delete A;
+
+  ASSERT_LE(deviation, getTolerance(inv_param.cpu_prec)) << "Host operator and reference do not agree";
+}
+
 TEST_P(DslashTest, benchmark)
 {
   dslashCUDA(1); // warm-up run
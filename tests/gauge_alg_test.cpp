@@ -244,6 +244,43 @@ TEST_F(GaugeAlgTest, Coulomb_FFT)
   }
 }
 
+TEST_F(GaugeAlgTest, Host_Observables)
+{
+  // the host observables need an exchanged halo in partitioned dimensions
+  if (!checkDimsPartitioned()) {
+    printfQuda("Host gauge observables\n");
+    GaugeFieldParam hParam(nullptr, param);
+    hParam.create = QUDA_NULL_FIELD_CREATE;
+    hParam.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+    cpuGaugeField U_h(hParam);
+    U->saveCPUField(U_h);
+
+    TimeProfile profile("Host_Observables");
+    QudaGaugeObservableParam obs_d = newQudaGaugeObservableParam();
+    obs_d.compute_plaquette = QUDA_BOOLEAN_TRUE;
+    obs_d.compute_qcharge = QUDA_BOOLEAN_TRUE;
+    QudaGaugeObservableParam obs_h = obs_d;
+
+    profile.TPSTART(QUDA_PROFILE_TOTAL);
+    gaugeObservables(*U, obs_d, profile);
+    profile.TPSTOP(QUDA_PROFILE_TOTAL);
+    profile.TPSTART(QUDA_PROFILE_TOTAL);
+    gaugeObservables(U_h, obs_h, profile);
+    profile.TPSTOP(QUDA_PROFILE_TOTAL);
+
+    printfQuda("Device: plaq %.16e, Q %.16e\n", obs_d.plaquette[0], obs_d.qcharge);
+    printfQuda("Host:   plaq %.16e, Q %.16e\n", obs_h.plaquette[0], obs_h.qcharge);
+
+    // the sums are taken in a different order, so allow for rounding
+    const double tol = prec == QUDA_DOUBLE_PRECISION ? 1e-12 : 1e-5;
+    for (int i = 0; i < 3; i++) {
+      EXPECT_NEAR(obs_h.plaquette[i], obs_d.plaquette[i], tol) << "plaquette " << i;
+      EXPECT_NEAR(obs_h.energy[i], obs_d.energy[i], tol * std::max(1.0, std::abs(obs_d.energy[i]))) << "energy " << i;
+    }
+    EXPECT_NEAR(obs_h.qcharge, obs_d.qcharge, tol * std::max(1.0, std::abs(obs_d.qcharge)));
+  }
+}
+
 int main(int argc, char **argv)
 {
   // initalize google test, includes command line options
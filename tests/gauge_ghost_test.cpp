@@ -0,0 +1,129 @@
+#include <vector>
+
+#include <quda.h>
+#include <quda_internal.h>
+#include <gauge_field.h>
+#include <comm_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Host ghost exchange of bi-directional (coarse) links.  Every link
+   element is set from its global site, link index and element, so
+   the ghost zone of each dimension must equal the ghost extracted
+   locally from a field holding the values of the backward neighbour
+   in that dimension.  Run on several ranks this checks the exchange
+   itself; on a single rank it checks the local fill.
+*/
+
+using namespace quda;
+
+constexpr int coarse_color = 48; // smallest coarse color count that is always instantiated
+
+static double linkValue(const int *g, const int *G, int mu, int k)
+{
+  int g_lin = ((g[3] * G[2] + g[2]) * G[1] + g[1]) * G[0] + g[0];
+  return 1000.0 * (g_lin * 8 + mu) + k;
+}
+
+/**
+   Fill a QDP ordered coarse field, shifting the rank coordinate in
+   dimension shift_dim back by one (if shift_dim >= 0)
+*/
+static void fill(cpuGaugeField &u, int shift_dim)
+{
+  const int *X = u.X();
+  const int n_internal = 2 * coarse_color * coarse_color;
+  int G[4], rank[4];
+  for (int d = 0; d < 4; d++) {
+    G[d] = comm_dim(d) * X[d];
+    rank[d] = comm_coord(d);
+    if (d == shift_dim) rank[d] = (rank[d] - 1 + comm_dim(d)) % comm_dim(d);
+  }
+
+  auto gauge = static_cast<double **>(u.Gauge_p());
+  for (int mu = 0; mu < 8; mu++) {
+    for (int x_full = 0; x_full < u.Volume(); x_full++) {
+      int x[4] = {x_full % X[0], (x_full / X[0]) % X[1], (x_full / (X[0] * X[1])) % X[2], x_full / (X[0] * X[1] * X[2])};
+      int g[4];
+      for (int d = 0; d < 4; d++) g[d] = rank[d] * X[d] + x[d];
+      int parity = (x[0] + x[1] + x[2] + x[3]) & 1;
+      size_t index = (size_t)(parity * u.VolumeCB() + x_full / 2) * n_internal;
+      for (int k = 0; k < n_internal; k++) gauge[mu][index + k] = linkValue(g, G, mu, k);
+    }
+  }
+}
+
+TEST(GaugeGhost, bidirectional)
+{
+  GaugeFieldParam param;
+  for (int d = 0; d < 4; d++) param.x[d] = d < 3 ? 2 : 4;
+  param.nDim = 4;
+  param.nColor = coarse_color;
+  param.nFace = 1;
+  param.reconstruct = QUDA_RECONSTRUCT_NO;
+  param.order = QUDA_QDP_GAUGE_ORDER;
+  param.link_type = QUDA_COARSE_LINKS;
+  param.t_boundary = QUDA_PERIODIC_T;
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.setPrecision(QUDA_DOUBLE_PRECISION);
+  param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  param.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
+  param.geometry = QUDA_COARSE_GEOMETRY;
+  param.pad = 0;
+
+  cpuGaugeField u(param);
+  fill(u, -1);
+  u.exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+
+  cpuGaugeField neighbour(param);
+  const size_t n_internal = 2 * coarse_color * coarse_color;
+  for (int d = 0; d < 4; d++) {
+    fill(neighbour, d);
+
+    const size_t length = 2 * u.SurfaceCB(d) * n_internal;
+    std::vector<std::vector<double>> expected(8, std::vector<double>(length));
+    void *ghost[8];
+    for (int i = 0; i < 8; i++) ghost[i] = expected[i].data();
+    extractGaugeGhost(neighbour, ghost, true);
+    extractGaugeGhost(neighbour, ghost + 4, true, 4);
+
+    for (int dir = 0; dir < 2; dir++) {
+      auto received = static_cast<const double *>(u.Ghost()[dir * 4 + d]);
+      int mismatch = 0;
+      for (size_t i = 0; i < length; i++)
+        if (received[i] != expected[dir * 4 + d][i]) mismatch++;
+      EXPECT_EQ(mismatch, 0) << "dimension " << d << (dir ? " forward" : " backward") << " links";
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  int test_rc = 0;
+
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  // Ensure gtest prints only from rank 0
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+
+  initQuda(device_ordinal);
+  test_rc = RUN_ALL_TESTS();
+  endQuda();
+
+  finalizeComms();
+
+  return test_rc;
+}
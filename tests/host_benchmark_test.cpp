@@ -0,0 +1,384 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <color_spinor_field.h>
+#include <gauge_field.h>
+#include <blas_quda.h>
+#include <dirac_quda.h>
+#include <transfer.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+#include <misc.h>
+#include <wilson_dslash_reference.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+/**
+   Host-side benchmark harness for the CPU code paths: the coarse
+   dslash, the prolongator and restrictor, a selection of BLAS kernels
+   and the host reference Wilson operator.  Each kernel is timed on
+   CPU fields over a sweep of local volume, coarse color count, number
+   of right-hand sides and OpenMP thread count, and reported with its
+   flop rate, bytes moved and arithmetic intensity (flops per byte).
+
+   Bytes moved follow the same model as the device kernels: every
+   operand gathered or written by a site is counted, with no credit
+   for cache reuse between neighbouring sites, so the arithmetic
+   intensity is the roofline abscissa of the kernel rather than a
+   measurement of cache behaviour.  Results can also be written as a
+   JSON array with --bench-json, for tracking host performance across
+   releases.
+*/
+
+using namespace quda;
+
+std::vector<int> bench_L = {8};
+std::vector<int> bench_ncolor = {24, 32};
+std::vector<int> bench_nvec = {1};
+std::vector<int> bench_threads;
+std::string bench_json;
+
+struct BenchResult {
+  std::string kernel;
+  int L;
+  int ncolor;
+  int nvec;
+  int threads;
+  double secs;
+  double flops; // flops per application
+  double bytes; // bytes moved per application
+};
+
+std::vector<BenchResult> results;
+
+void record(const std::string &kernel, int L, int ncolor, int nvec, int threads, double secs, double flops,
+            double bytes)
+{
+  BenchResult r = {kernel, L, ncolor, nvec, threads, secs, flops, bytes};
+  results.push_back(r);
+  double gflops = niter * flops * 1e-9 / secs;
+  double gbytes = niter * bytes * 1e-9 / secs;
+  printfQuda("%-16s %4d %6d %5d %7d %12.3f %10.2f %10.2f %10.3f\n", kernel.c_str(), L, ncolor, nvec, threads,
+             1e6 * secs / niter, gflops, gbytes, flops / bytes);
+}
+
+void writeJSON(const std::string &filename)
+{
+  if (comm_rank() != 0) return;
+  FILE *f = fopen(filename.c_str(), "w");
+  if (!f) errorQuda("Unable to open %s for writing", filename.c_str());
+  fprintf(f, "[\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchResult &r = results[i];
+    fprintf(f,
+            "  {\"kernel\": \"%s\", \"L\": %d, \"ncolor\": %d, \"nvec\": %d, \"threads\": %d, \"ranks\": %d, "
+            "\"precision\": \"%s\", \"niter\": %d, \"seconds\": %.6e, \"gflops\": %.4f, \"gbytes\": %.4f, "
+            "\"intensity\": %.4f}%s\n",
+            r.kernel.c_str(), r.L, r.ncolor, r.nvec, r.threads, comm_size(), get_prec_str(prec), niter, r.secs,
+            niter * r.flops * 1e-9 / r.secs, niter * r.bytes * 1e-9 / r.secs, r.flops / r.bytes,
+            i + 1 < results.size() ? "," : "");
+  }
+  fprintf(f, "]\n");
+  fclose(f);
+  printfQuda("Wrote %lu results to %s\n", results.size(), filename.c_str());
+}
+
+void setThreads(int threads)
+{
+#ifdef _OPENMP
+  omp_set_num_threads(threads);
+#else
+  if (threads != 1) errorQuda("Requested %d threads but OpenMP is not enabled", threads);
+#endif
+}
+
+int maxThreads()
+{
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+template <typename F> double timeKernel(F f)
+{
+  f(); // warm up
+  comm_barrier();
+  stopwatchStart();
+  for (int i = 0; i < niter; i++) f();
+  double secs = stopwatchReadSeconds();
+  comm_allreduce_max(&secs);
+  return secs;
+}
+
+ColorSpinorParam hostSpinorParam(int L, int nSpin, int nColor, int nvec)
+{
+  ColorSpinorParam param;
+  param.nColor = nColor;
+  param.nSpin = nSpin;
+  param.nDim = nvec > 1 ? 5 : 4;
+  param.pad = 0; // padding must be zero for cpu fields
+  param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  for (int d = 0; d < 4; d++) param.x[d] = L;
+  param.x[4] = nvec;
+  param.pc_type = QUDA_4D_PC;
+  param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  param.setPrecision(prec);
+  param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+  param.location = QUDA_CPU_FIELD_LOCATION;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  return param;
+}
+
+/**
+   Coarse operator: 8 hopping links and one clover term per site, each
+   a dense (Ns*Nc)^2 complex matrix, applied to nvec right-hand sides.
+*/
+void benchCoarse(int L, int nColor, int nvec, int threads)
+{
+  const int nSpin = 2;
+  ColorSpinorParam param = hostSpinorParam(L, nSpin, nColor, nvec);
+  ColorSpinorField *x = ColorSpinorField::Create(param);
+  ColorSpinorField *y = ColorSpinorField::Create(param);
+  spinorNoise(*y, 1234, QUDA_NOISE_GAUSS);
+
+  GaugeFieldParam gParam;
+  for (int d = 0; d < 4; d++) gParam.x[d] = L;
+  gParam.nColor = nColor * nSpin;
+  gParam.reconstruct = QUDA_RECONSTRUCT_NO;
+  gParam.order = QUDA_QDP_GAUGE_ORDER;
+  gParam.link_type = QUDA_COARSE_LINKS;
+  gParam.t_boundary = QUDA_PERIODIC_T;
+  gParam.create = QUDA_ZERO_FIELD_CREATE;
+  gParam.setPrecision(prec);
+  gParam.nDim = 4;
+  gParam.siteSubset = QUDA_FULL_SITE_SUBSET;
+  gParam.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
+  gParam.nFace = 1;
+  gParam.geometry = QUDA_COARSE_GEOMETRY;
+  cpuGaugeField *Y = new cpuGaugeField(gParam);
+  cpuGaugeField *Yhat = new cpuGaugeField(gParam);
+  gParam.geometry = QUDA_SCALAR_GEOMETRY;
+  gParam.nFace = 0;
+  cpuGaugeField *X = new cpuGaugeField(gParam);
+  cpuGaugeField *Xinv = new cpuGaugeField(gParam);
+
+  DiracParam diracParam;
+  diracParam.halo_precision = prec;
+  DiracCoarse dirac(diracParam, Y, X, Xinv, Yhat, nullptr, nullptr, nullptr, nullptr);
+
+  const int n = nSpin * nColor;
+  const double sites = x->Volume();
+  const double spinor_bytes = 2.0 * n * x->Precision();
+  const double link_bytes = 2.0 * n * n * Y->Precision();
+
+  double secs = timeKernel([&]() { dirac.Dslash(x->Even(), y->Odd(), QUDA_EVEN_PARITY); });
+  record("coarse_dslash", L, nColor, nvec, threads, secs, (8 * (8.0 * n * n) - 2 * n) * sites / 2,
+         (sites / 2) * (8 * spinor_bytes + spinor_bytes) + 8 * link_bytes * Y->VolumeCB());
+
+  secs = timeKernel([&]() { dirac.M(*x, *y); });
+  record("coarse_mat", L, nColor, nvec, threads, secs, (9 * (8.0 * n * n) - 2 * n) * sites,
+         sites * (9 * spinor_bytes + spinor_bytes) + 9 * link_bytes * Y->Volume());
+
+  delete X;
+  delete Xinv;
+  delete Y;
+  delete Yhat;
+  delete y;
+  delete x;
+}
+
+/**
+   Prolongator and restrictor between a fine Wilson-like field and a
+   coarse field with nColor colors, using 4^4 aggregates (or smaller
+   if the volume does not allow it).
+*/
+void benchTransfer(int L, int nColor, int threads)
+{
+  const int fineSpin = 4, fineColor = 3;
+  ColorSpinorParam param = hostSpinorParam(L, fineSpin, fineColor, 1);
+  std::vector<ColorSpinorField *> B(nColor);
+  for (int i = 0; i < nColor; i++) {
+    B[i] = ColorSpinorField::Create(param);
+    spinorNoise(*B[i], 1234 + i, QUDA_NOISE_GAUSS);
+  }
+
+  int geo_bs[QUDA_MAX_DIM] = {4, 4, 4, 4};
+  TimeProfile profile("Transfer");
+  Transfer transfer(B, nColor, 1, geo_bs, 2, prec, QUDA_TRANSFER_AGGREGATE, profile);
+  transfer.setTransferGPU(false);
+
+  ColorSpinorField *fine = ColorSpinorField::Create(param);
+  spinorNoise(*fine, 4321, QUDA_NOISE_GAUSS);
+  ColorSpinorField *coarse = fine->CreateCoarse(geo_bs, 2, nColor, prec, QUDA_CPU_FIELD_LOCATION);
+
+  const double fine_sites = fine->Volume();
+  const double fine_bytes = 2.0 * fineSpin * fineColor * fine->Precision() * fine_sites;
+  const double coarse_bytes = 2.0 * coarse->Nspin() * nColor * coarse->Precision() * coarse->Volume();
+  const double v_bytes = fine_bytes * nColor;
+  const double flops = 8.0 * fineSpin * fineColor * nColor * fine_sites;
+
+  double secs = timeKernel([&]() { transfer.R(*coarse, *fine); });
+  record("restrict", L, nColor, 1, threads, secs, flops, v_bytes + fine_bytes + coarse_bytes);
+
+  secs = timeKernel([&]() { transfer.P(*fine, *coarse); });
+  record("prolong", L, nColor, 1, threads, secs, flops, v_bytes + fine_bytes + coarse_bytes);
+
+  delete coarse;
+  delete fine;
+  for (auto b : B) delete b;
+}
+
+/**
+   BLAS kernels on a fine Wilson-like field, using the library flop and
+   byte counters.
+*/
+void benchBlas(int L, int threads)
+{
+  ColorSpinorParam param = hostSpinorParam(L, 4, 3, 1);
+  ColorSpinorField *x = ColorSpinorField::Create(param);
+  ColorSpinorField *y = ColorSpinorField::Create(param);
+  spinorNoise(*x, 1, QUDA_NOISE_GAUSS);
+  spinorNoise(*y, 2, QUDA_NOISE_GAUSS);
+
+  auto run = [&](const char *name, auto f) {
+    f(); // warm up before we reset the counters
+    blas::flops = 0;
+    blas::bytes = 0;
+    double secs = timeKernel(f);
+    // the counters include the warm up inside timeKernel
+    record(name, L, 3, 1, threads, secs, blas::flops / (niter + 1.0), blas::bytes / (niter + 1.0));
+  };
+
+  run("axpy", [&]() { blas::axpy(0.5, *x, *y); });
+  run("caxpy", [&]() { blas::caxpy(Complex(0.5, 0.25), *x, *y); });
+  run("norm2", [&]() { blas::norm2(*x); });
+  run("cDotProduct", [&]() { blas::cDotProduct(*x, *y); });
+
+  delete y;
+  delete x;
+}
+
+/**
+   Host reference Wilson operator from the test utilities.
+*/
+void benchReference(int L, int threads)
+{
+  xdim = ydim = zdim = tdim = L;
+  QudaGaugeParam gauge_param = newQudaGaugeParam();
+  setWilsonGaugeParam(gauge_param);
+  gauge_param.cpu_prec = prec;
+  setDims(gauge_param.X);
+
+  void *gauge[4];
+  for (int d = 0; d < 4; d++) gauge[d] = safe_malloc(V * gauge_site_size * prec);
+  constructQudaGaugeField(gauge, 1, prec, &gauge_param);
+
+  ColorSpinorParam param = hostSpinorParam(L, 4, 3, 1);
+  ColorSpinorField *in = ColorSpinorField::Create(param);
+  ColorSpinorField *out = ColorSpinorField::Create(param);
+  spinorNoise(*in, 1, QUDA_NOISE_GAUSS);
+
+  const double sites = in->Volume();
+  const double spinor_bytes = 24.0 * prec;
+  const double link_bytes = 18.0 * prec;
+
+  double secs = timeKernel([&]() { wil_mat(out->V(), gauge, in->V(), 0.1, 0, prec, gauge_param); });
+  record("wilson_ref_mat", L, 3, 1, threads, secs, (1320.0 + 48) * sites,
+         sites * (8 * spinor_bytes + 2 * spinor_bytes + 8 * link_bytes));
+
+  // the same operator through the host DiracWilson, which works in the UKQCD basis
+  GaugeFieldParam gParam(gauge, gauge_param);
+  gParam.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
+  cpuGaugeField U(gParam);
+  U.exchangeGhost();
+
+  DiracParam diracParam;
+  diracParam.type = QUDA_WILSON_DIRAC;
+  diracParam.kappa = 0.1;
+  diracParam.gauge_h = &U;
+  DiracWilson dirac(diracParam);
+
+  param.gammaBasis = QUDA_UKQCD_GAMMA_BASIS;
+  ColorSpinorField *in_uk = ColorSpinorField::Create(param);
+  ColorSpinorField *out_uk = ColorSpinorField::Create(param);
+  copyGenericColorSpinor(*in_uk, *in, QUDA_CPU_FIELD_LOCATION); // host field assignment does not change basis
+
+  secs = timeKernel([&]() { dirac.M(*out_uk, *in_uk); });
+  record("wilson_dirac_mat", L, 3, 1, threads, secs, 1368.0 * sites,
+         sites * (8 * spinor_bytes + 2 * spinor_bytes + 8 * link_bytes));
+
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  ColorSpinorField *check = ColorSpinorField::Create(param);
+  copyGenericColorSpinor(*check, *out_uk, QUDA_CPU_FIELD_LOCATION);
+  double ref = blas::norm2(*out);
+  double dev = blas::xmyNorm(*out, *check);
+  printfQuda("wilson_dirac_mat relative deviation from reference = %e\n", sqrt(dev / ref));
+
+  delete check;
+  delete out_uk;
+  delete in_uk;
+  delete out;
+  delete in;
+  for (int d = 0; d < 4; d++) host_free(gauge[d]);
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  CLI::TransformPairs<int> test_type_map {{"all", 0}, {"coarse", 1}, {"transfer", 2}, {"blas", 3}, {"reference", 4}};
+  app->add_option("--test", test_type, "Which host kernels to benchmark (default all)")
+    ->transform(CLI::CheckedTransformer(test_type_map));
+  app->add_option("--bench-L", bench_L, "Local lattice extents L (L^4 sites) to sweep over");
+  app->add_option("--bench-ncolor", bench_ncolor, "Coarse color counts to sweep over");
+  app->add_option("--bench-nvec", bench_nvec, "Number of coarse right-hand sides to sweep over");
+  app->add_option("--bench-threads", bench_threads, "OpenMP thread counts to sweep over (default max threads)");
+  app->add_option("--bench-json", bench_json, "Write the results as JSON to this file");
+
+  test_type = 0;
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+  if (bench_threads.empty()) bench_threads.push_back(maxThreads());
+
+  initComms(argc, argv, gridsize_from_cmdline);
+  initQuda(device_ordinal);
+  setVerbosity(verbosity);
+
+  printfQuda("\nBenchmarking host kernels in %s precision with %d iterations\n\n", get_prec_str(prec), niter);
+  printfQuda("%-16s %4s %6s %5s %7s %12s %10s %10s %10s\n", "kernel", "L", "ncolor", "nvec", "threads", "time (us)",
+             "Gflop/s", "GB/s", "flop/byte");
+
+  for (auto threads : bench_threads) {
+    setThreads(threads);
+    for (auto L : bench_L) {
+      if (test_type == 0 || test_type == 1)
+        for (auto nColor : bench_ncolor)
+          for (auto nvec : bench_nvec) benchCoarse(L, nColor, nvec, threads);
+      if (test_type == 0 || test_type == 2)
+        for (auto nColor : bench_ncolor) benchTransfer(L, nColor, threads);
+      if (test_type == 0 || test_type == 3) benchBlas(L, threads);
+      if (test_type == 0 || test_type == 4) benchReference(L, threads);
+    }
+  }
+
+  if (!bench_json.empty()) writeJSON(bench_json);
+
+  endQuda();
+  finalizeComms();
+  return 0;
+}
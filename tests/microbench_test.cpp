@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <tune_quda.h>
+#include <malloc_quda.h>
+#include <timer.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Host-side microbenchmarks for the infrastructure every kernel launch
+   goes through: tune key construction, tuneLaunch for a tuned kernel
+   (a tune cache hit) and an untuned one, the pinned memory pool, the TimeProfile start/stop pair
+   and a scalar comm_allreduce.  Each benchmark reports the median
+   cost per call over several repetitions, so that per-call overhead
+   that creeps up over time is noticed before it shows up as latency
+   in short solver iterations.  Wall-clock timings depend on the
+   machine and its load, so by default nothing is asserted: a
+   regression threshold for a given machine can be set on the command
+   line, and the benchmark then fails if it is exceeded.  The ctest
+   sets loose thresholds that only catch gross regressions.
+*/
+
+using namespace quda;
+
+// regression thresholds in nanoseconds per call, not checked if zero
+double tune_key_threshold = 0;
+double tune_launch_threshold = 0;
+double tune_launch_untuned_threshold = 0;
+double pool_threshold = 0;
+double profile_threshold = 0;
+double allreduce_threshold = 0;
+
+// number of calls per repetition and number of repetitions
+int calls = 10000;
+int reps = 9;
+
+// keeps the compiler from eliding benchmarked work whose result is unused
+volatile char sink;
+
+/**
+   Return the median time per call in nanoseconds of f, over reps
+   repetitions of calls invocations each.
+*/
+template <typename F> double nsPerCall(F f)
+{
+  for (int i = 0; i < calls / 10 + 1; i++) f(); // warm up
+
+  std::vector<double> t(reps);
+  for (int r = 0; r < reps; r++) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < calls; i++) f();
+    auto end = std::chrono::high_resolution_clock::now();
+    t[r] = std::chrono::duration<double, std::nano>(end - start).count() / calls;
+  }
+  std::nth_element(t.begin(), t.begin() + reps / 2, t.end());
+  double ns = t[reps / 2];
+  comm_allreduce_max(&ns);
+  return ns;
+}
+
+void report(const char *name, double ns, double threshold)
+{
+  ::testing::Test::RecordProperty("ns_per_call", std::to_string(ns));
+  if (threshold > 0) {
+    printfQuda("%-24s %10.1f ns/call (threshold %.1f)\n", name, ns, threshold);
+    EXPECT_LT(ns, threshold) << name << " per-call overhead has regressed";
+  } else {
+    printfQuda("%-24s %10.1f ns/call\n", name, ns);
+  }
+}
+
+/**
+   A tunable that does no work, with a tune key built the same way as
+   the kernels build theirs: volume string, type name and an aux
+   string assembled from the field and kernel properties.
+*/
+class NullTunable : public Tunable
+{
+  char vol[TuneKey::volume_n];
+
+  long long flops() const { return 0; }
+  unsigned int sharedBytesPerThread() const { return 0; }
+  unsigned int sharedBytesPerBlock(const TuneParam &) const { return 0; }
+  bool advanceTuneParam(TuneParam &) const { return false; }
+
+public:
+  NullTunable()
+  {
+    strcpy(vol, "16x16x16x16");
+    strcpy(aux, "vol=65536,stride=32768,precision=4,order=4,Ns=4,Nc=3");
+    strcat(aux, ",GPU");
+  }
+
+  TuneKey tuneKey() const { return TuneKey(vol, typeid(*this).name(), aux); }
+  void apply(const qudaStream_t &) { }
+};
+
+TEST(microbench, tune_key)
+{
+  NullTunable tunable;
+  double ns = nsPerCall([&]() { sink = sink + tunable.tuneKey().aux[0]; });
+  report("TuneKey construction", ns, tune_key_threshold);
+}
+
+// the kernel is tuned once first, so every timed call is a tune cache hit
+TEST(microbench, tune_launch)
+{
+  NullTunable tunable;
+  tuneLaunch(tunable, QUDA_TUNE_YES, QUDA_SILENT);
+  double ns = nsPerCall([&]() { tuneLaunch(tunable, QUDA_TUNE_YES, QUDA_SILENT); });
+  report("tuneLaunch cache hit", ns, tune_launch_threshold);
+}
+
+// untuned launches still look up the cache, then fall back to the default launch parameters
+TEST(microbench, tune_launch_untuned)
+{
+  NullTunable tunable;
+  double ns = nsPerCall([&]() { tuneLaunch(tunable, QUDA_TUNE_NO, QUDA_SILENT); });
+  report("tuneLaunch untuned", ns, tune_launch_untuned_threshold);
+}
+
+TEST(microbench, pool_pinned_malloc)
+{
+  const size_t bytes = 1 << 20;
+  double ns = nsPerCall([&]() {
+    void *p = pool_pinned_malloc(bytes);
+    pool_pinned_free(p);
+  });
+  report("pool_pinned malloc/free", ns, pool_threshold);
+}
+
+TEST(microbench, time_profile)
+{
+  TimeProfile profile("microbench");
+  double ns = nsPerCall([&]() {
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+  });
+  report("TimeProfile start/stop", ns, profile_threshold);
+}
+
+TEST(microbench, comm_allreduce)
+{
+  double ns = nsPerCall([&]() {
+    double sum = 1.0;
+    comm_allreduce(&sum);
+  });
+  report("comm_allreduce", ns, allreduce_threshold);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  auto app = make_app();
+  app->add_option("--calls", calls, "Calls per repetition (default 10000)");
+  app->add_option("--reps", reps, "Repetitions, the median of which is reported (default 9)");
+  app->add_option("--tune-key-threshold", tune_key_threshold, "TuneKey construction threshold in ns (default unchecked)");
+  app->add_option("--tune-launch-threshold", tune_launch_threshold, "tuneLaunch cache hit threshold in ns (default unchecked)");
+  app->add_option("--tune-launch-untuned-threshold", tune_launch_untuned_threshold,
+                  "Untuned tuneLaunch threshold in ns (default unchecked)");
+  app->add_option("--pool-threshold", pool_threshold, "Pinned pool malloc/free threshold in ns (default unchecked)");
+  app->add_option("--profile-threshold", profile_threshold, "TimeProfile start/stop threshold in ns (default unchecked)");
+  app->add_option("--allreduce-threshold", allreduce_threshold, "comm_allreduce threshold in ns (default unchecked)");
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+  if (calls < 1 || reps < 1) errorQuda("Invalid calls %d or reps %d", calls, reps);
+
+  initComms(argc, argv, gridsize_from_cmdline);
+  initQuda(device_ordinal);
+  setVerbosity(verbosity);
+
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+  int result = RUN_ALL_TESTS();
+
+  endQuda();
+  finalizeComms();
+  return result;
+}
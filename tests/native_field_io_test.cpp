@@ -0,0 +1,163 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <quda.h>
+#include <quda_internal.h>
+#include <color_spinor_field.h>
+#include <gauge_field.h>
+#include <comm_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Round trip of fields through the native binary format of
+   LatticeField::write and LatticeField::read.  A field is written,
+   read back into a new field (which verifies the per-rank checksums),
+   and the new field written again: the two files, header, checksum
+   table and data, must be identical, as must the field contents.
+*/
+
+using namespace quda;
+
+static std::vector<char> slurp(const char *filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+   Write a, read it into b and write b, then return whether the two
+   files are identical
+*/
+static bool roundTrip(LatticeField &a, LatticeField &b)
+{
+  char file_a[] = "native_field_io_test_a.tmp";
+  char file_b[] = "native_field_io_test_b.tmp";
+  a.write(file_a);
+  b.read(file_a);
+  b.write(file_b);
+
+  bool identical = true;
+  if (comm_rank() == 0) {
+    identical = slurp(file_a) == slurp(file_b);
+    remove(file_a);
+    remove(file_b);
+  }
+  comm_barrier();
+  return identical;
+}
+
+static ColorSpinorParam spinorParam(QudaSiteSubset site_subset)
+{
+  ColorSpinorParam param;
+  param.nColor = 3;
+  param.nSpin = 4;
+  param.nDim = 4;
+  param.pad = 0;
+  param.siteSubset = site_subset;
+  param.x[0] = site_subset == QUDA_PARITY_SITE_SUBSET ? 2 : 4;
+  for (int d = 1; d < 4; d++) param.x[d] = 4;
+  param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  param.setPrecision(QUDA_DOUBLE_PRECISION);
+  param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+  param.location = QUDA_CPU_FIELD_LOCATION;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  return param;
+}
+
+TEST(NativeFieldIO, host_spinor)
+{
+  ColorSpinorParam param = spinorParam(QUDA_FULL_SITE_SUBSET);
+  cpuColorSpinorField a(param), b(param);
+  a.Source(QUDA_RANDOM_SOURCE);
+
+  EXPECT_TRUE(roundTrip(a, b));
+  EXPECT_EQ(memcmp(a.V(), b.V(), a.Bytes()), 0);
+}
+
+TEST(NativeFieldIO, device_half_spinor)
+{
+  // fixed-point fields are stored as two segments, the data and the site norms
+  ColorSpinorParam host_param = spinorParam(QUDA_PARITY_SITE_SUBSET);
+  cpuColorSpinorField host(host_param), host_a(host_param), host_b(host_param);
+  host.Source(QUDA_RANDOM_SOURCE);
+
+  ColorSpinorParam param(host_param);
+  param.location = QUDA_CUDA_FIELD_LOCATION;
+  param.setPrecision(QUDA_HALF_PRECISION, QUDA_HALF_PRECISION, true);
+  cudaColorSpinorField a(param), b(param);
+  a = host;
+
+  EXPECT_TRUE(roundTrip(a, b));
+  host_a = a;
+  host_b = b;
+  EXPECT_EQ(memcmp(host_a.V(), host_b.V(), host_a.Bytes()), 0);
+}
+
+TEST(NativeFieldIO, host_qdp_gauge)
+{
+  // each link direction of a QDP ordered field is its own segment
+  GaugeFieldParam param;
+  for (int d = 0; d < 4; d++) param.x[d] = 4;
+  param.nDim = 4;
+  param.nColor = 3;
+  param.nFace = 0;
+  param.reconstruct = QUDA_RECONSTRUCT_NO;
+  param.order = QUDA_QDP_GAUGE_ORDER;
+  param.link_type = QUDA_WILSON_LINKS;
+  param.t_boundary = QUDA_PERIODIC_T;
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.setPrecision(QUDA_SINGLE_PRECISION);
+  param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+  param.geometry = QUDA_VECTOR_GEOMETRY;
+  param.pad = 0;
+
+  cpuGaugeField a(param), b(param);
+  std::mt19937 rng(1234 + comm_rank());
+  std::uniform_real_distribution<float> uniform(-1.0, 1.0);
+  const size_t length = a.Bytes() / (a.Geometry() * sizeof(float));
+  auto links_a = static_cast<float **>(a.Gauge_p());
+  auto links_b = static_cast<float **>(b.Gauge_p());
+  for (int mu = 0; mu < a.Geometry(); mu++)
+    for (size_t i = 0; i < length; i++) links_a[mu][i] = uniform(rng);
+
+  EXPECT_TRUE(roundTrip(a, b));
+  for (int mu = 0; mu < a.Geometry(); mu++)
+    EXPECT_EQ(memcmp(links_a[mu], links_b[mu], length * sizeof(float)), 0) << "direction " << mu;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  int test_rc = 0;
+
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  // Ensure gtest prints only from rank 0
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+
+  initQuda(device_ordinal);
+  test_rc = RUN_ALL_TESTS();
+  endQuda();
+
+  finalizeComms();
+
+  return test_rc;
+}
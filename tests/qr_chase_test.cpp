@@ -0,0 +1,148 @@
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <quda_internal.h>
+#include <eigensolve_quda.h>
+#include <eigen_helper.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Host tests of the bulge chasing QR of IRAM on small random upper
+   Hessenberg matrices.  The chased matrix is checked against dense
+   shifted QR steps H - s = QR, H <- RQ + s, which by the implicit Q
+   theorem it equals up to a diagonal unitary similarity, so the
+   magnitudes of the elements are compared.  The accumulated Q must be
+   unitary and relate the two matrices, so the eigenvalues are
+   preserved, and a chain of shifts chased together with a short
+   deferral block must agree with the shifts applied one at a time.
+*/
+
+using namespace quda;
+
+static std::mt19937 rng(1234);
+
+static Complex random_complex()
+{
+  std::normal_distribution<double> normal(0.0, 1.0);
+  double re = normal(rng);
+  double im = normal(rng);
+  return Complex(re, im);
+}
+
+static MatrixXcd random_hessenberg(int n)
+{
+  MatrixXcd H = MatrixXcd::Zero(n, n);
+  for (int i = 0; i < n; i++)
+    for (int j = std::max(0, i - 1); j < n; j++) H(i, j) = random_complex();
+  return H;
+}
+
+/**
+   Row pointer storage of a dense matrix, as IRAM keeps its upper
+   Hessenberg and Q matrices
+*/
+struct RowMatrix {
+  int n;
+  std::vector<Complex> data;
+  std::vector<Complex *> rows;
+
+  RowMatrix(const MatrixXcd &A) : n(A.rows()), data(n * n), rows(n)
+  {
+    for (int i = 0; i < n; i++) {
+      rows[i] = data.data() + i * n;
+      for (int j = 0; j < n; j++) rows[i][j] = A(i, j);
+    }
+  }
+
+  MatrixXcd dense() const
+  {
+    MatrixXcd A(n, n);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++) A(i, j) = rows[i][j];
+    return A;
+  }
+};
+
+// the shifted QR steps applied densely, one after another
+static MatrixXcd dense_qr_steps(MatrixXcd H, const std::vector<Complex> &shifts)
+{
+  const int n = H.rows();
+  for (auto s : shifts) {
+    HouseholderQR<MatrixXcd> qr(H - s * MatrixXcd::Identity(n, n));
+    MatrixXcd Q = qr.householderQ();
+    H = Q.adjoint() * H * Q;
+  }
+  return H;
+}
+
+/**
+   Chase the shifts through H and check the result, returning the
+   chased matrix
+*/
+static MatrixXcd check(const MatrixXcd &H0, const std::vector<Complex> &shifts, int chase_steps)
+{
+  const int n = H0.rows();
+  RowMatrix H(H0), Q(MatrixXcd::Identity(n, n));
+  qrChase(Q.rows.data(), H.rows.data(), n, shifts.data(), static_cast<int>(shifts.size()), 0.0, chase_steps);
+  MatrixXcd Hc = H.dense(), Qc = Q.dense();
+
+  const double tol = 1e-12 * n * H0.norm();
+
+  // Q is unitary and H is transformed by it
+  EXPECT_LT((Qc.adjoint() * Qc - MatrixXcd::Identity(n, n)).norm(), 1e-12 * n);
+  EXPECT_LT((Qc.adjoint() * H0 * Qc - Hc).norm(), tol);
+
+  // H remains upper Hessenberg
+  for (int i = 2; i < n; i++)
+    for (int j = 0; j < i - 1; j++) EXPECT_LT(std::abs(Hc(i, j)), tol) << "element (" << i << ", " << j << ")";
+
+  // and agrees with the dense QR steps up to the phases of the basis
+  MatrixXcd Hd = dense_qr_steps(H0, shifts);
+  EXPECT_LT((Hc.cwiseAbs() - Hd.cwiseAbs()).norm(), tol);
+
+  // so the eigenvalues are preserved
+  ComplexEigenSolver<MatrixXcd> eig0(H0), eigc(Hc);
+  for (int i = 0; i < n; i++) {
+    double dist = std::numeric_limits<double>::max();
+    for (int j = 0; j < n; j++) dist = std::min(dist, std::abs(eig0.eigenvalues()[i] - eigc.eigenvalues()[j]));
+    EXPECT_LT(dist, 1e-10 * H0.norm()) << "eigenvalue " << i;
+  }
+
+  return Hc;
+}
+
+TEST(QRChase, single_shift)
+{
+  MatrixXcd H = random_hessenberg(12);
+  check(H, {random_complex()}, IRAM::qr_chase_steps);
+}
+
+TEST(QRChase, shift_chain)
+{
+  // a short deferral block, so that the deferred rotations are applied several times per chain
+  MatrixXcd H = random_hessenberg(16);
+  std::vector<Complex> shifts {random_complex(), random_complex(), random_complex(), random_complex()};
+  MatrixXcd Hc = check(H, shifts, 3);
+
+  // the chain equals the shifts applied one at a time
+  RowMatrix Hs(H), Q(MatrixXcd::Identity(16, 16));
+  for (auto &s : shifts) qrChase(Q.rows.data(), Hs.rows.data(), 16, &s, 1, 0.0);
+  EXPECT_LT((Hc - Hs.dense()).norm(), 1e-12 * 16 * H.norm());
+}
+
+TEST(QRChase, split)
+{
+  // a zero sub-diagonal element splits H into blocks that are chased independently
+  MatrixXcd H = random_hessenberg(12);
+  H(5, 4) = 0.0;
+  MatrixXcd Hc = check(H, {random_complex(), random_complex()}, 2);
+  EXPECT_EQ(Hc(5, 4), Complex(0.0));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
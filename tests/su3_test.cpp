@@ -11,6 +11,8 @@
 #include <misc.h>
 
 #include <comm_quda.h>
+#include <gauge_field.h>
+#include <gauge_tools.h>
 
 // In a typical application, quda.h is the only QUDA header required.
 #include <quda.h>
@@ -97,6 +99,59 @@ void setGaugeParam(QudaGaugeParam &gauge_param) {
 #endif
 }
 
+// Repeat the smearing or flow in place on the host field as an
+// independent reference for the device result, and compare the
+// plaquette and topological charge of the two.  Returns the number of
+// observables that disagree beyond a tolerance set by the device
+// precision.
+int hostSmearingReference(void **gauge, QudaGaugeParam &gauge_param, const double device_plaq[3],
+                          double device_qcharge)
+{
+  quda::GaugeFieldParam gParam(gauge, gauge_param);
+  quda::cpuGaugeField u(gParam);
+  std::vector<quda::GaugeObservablesCPU> obs;
+
+  double time0 = -((double)clock());
+  switch (test_type) {
+  case 0: quda::APEStepCPU(u, ape_smear_rho, smear_steps); break;
+  case 1: quda::STOUTStepCPU(u, stout_smear_rho, smear_steps); break;
+  case 2: quda::OvrImpSTOUTStepCPU(u, stout_smear_rho, stout_smear_epsilon, smear_steps); break;
+  case 3: quda::WFlowCPU(u, wflow_epsilon, wflow_steps, wflow_type, measurement_interval, &obs); break;
+  default: errorQuda("Undefined test type %d given", test_type);
+  }
+  time0 += clock();
+  time0 /= CLOCKS_PER_SEC;
+  printfQuda("Total time for host reference = %g secs\n", time0);
+
+  if (test_type == 3) {
+    printfQuda("host flow t, plaquette, E_tot, E_spatial, E_temporal, Q charge\n");
+    for (auto i = 0u; i < obs.size(); i++) {
+      printfQuda("%le %.16e %+.16e %+.16e %+.16e %+.16e\n", wflow_epsilon * i * measurement_interval,
+                 obs[i].plaquette[0], obs[i].energy[0], obs[i].energy[1], obs[i].energy[2], obs[i].qcharge);
+    }
+  }
+
+  quda::GaugeObservablesCPU o;
+  quda::gaugeObservablesCPU(o, u, true);
+
+  // the plaquette is compared relative to its value, the charge
+  // relative to its value or one, whichever is larger
+  double tol = prec == QUDA_DOUBLE_PRECISION ? 1e-8 : (prec == QUDA_SINGLE_PRECISION ? 1e-4 : 1e-2);
+  int fail = 0;
+
+  double plaq_dev = fabs(device_plaq[0] - o.plaquette[0]) / fabs(o.plaquette[0]);
+  printfQuda("GPU plaquette %.16e and host reference %.16e. Relative deviation: %e (tolerance %e) %s\n",
+             device_plaq[0], o.plaquette[0], plaq_dev, tol, plaq_dev <= tol ? "PASSED" : "FAILED");
+  if (!(plaq_dev <= tol)) fail++;
+
+  double q_dev = fabs(device_qcharge - o.qcharge) / MAX(fabs(o.qcharge), 1.0);
+  printfQuda("GPU Q charge %e and host reference %e. Q charge deviation: %e (tolerance %e) %s\n", device_qcharge,
+             o.qcharge, device_qcharge - o.qcharge, tol, q_dev <= tol ? "PASSED" : "FAILED");
+  if (!(q_dev <= tol)) fail++;
+
+  return fail;
+}
+
 int main(int argc, char **argv)
 {
 
@@ -124,6 +179,7 @@ int main(int argc, char **argv)
   setDims(gauge_param.X);
 
   void *gauge[4], *new_gauge[4];
+  int test_rc = 0;
 
   for (int dir = 0; dir < 4; dir++) {
     gauge[dir] = malloc(V * gauge_site_size * host_gauge_data_type_size);
@@ -238,12 +294,23 @@ int main(int argc, char **argv)
   default: errorQuda("Undefined test type %d given", test_type);
   }
 
+  // the smeared field is the one measured after smearing
+  param.compute_plaquette = QUDA_BOOLEAN_TRUE;
+  gaugeObservablesQuda(&param);
+  double device_qcharge = param.qcharge;
+
 #else
   printfQuda("Skipping other gauge tests since gauge tools have not been compiled\n");
 #endif
 
   if (verify_results) check_gauge(gauge, new_gauge, 1e-3, gauge_param.cpu_prec);
 
+#ifdef GPU_GAUGE_TOOLS
+  // the host reference needs a halo when partitioned, so is only run on a single process
+  if (verify_results && comm_size() == 1)
+    test_rc = hostSmearingReference(gauge, gauge_param, param.plaquette, device_qcharge);
+#endif
+
   freeGaugeQuda();
   endQuda();
 
@@ -254,5 +321,5 @@ int main(int argc, char **argv)
   }
 
   finalizeComms();
-  return 0;
+  return test_rc;
 }
@@ -0,0 +1,172 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <quda.h>
+#include <quda_internal.h>
+#include <color_spinor_field.h>
+#include <vector_io.h>
+#include <comm_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Round trip of sets of vectors through VectorIO.  Each set holds
+   more vectors than one chunk, so the streamed save and load paths
+   run over several chunks, including a final partial one.  Fields
+   are double precision so the round trip is bit exact.
+*/
+
+using namespace quda;
+
+constexpr int n_vec = 5;
+constexpr int chunk_size = 2;
+
+static ColorSpinorParam hostParam(QudaSiteSubset site_subset)
+{
+  ColorSpinorParam param;
+  param.nColor = 3;
+  param.nSpin = 4;
+  param.nDim = 4;
+  param.pad = 0;
+  param.siteSubset = site_subset;
+  param.x[0] = site_subset == QUDA_PARITY_SITE_SUBSET ? 2 : 4;
+  for (int d = 1; d < 4; d++) param.x[d] = 4;
+  param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  param.setPrecision(QUDA_DOUBLE_PRECISION);
+  param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+  param.location = QUDA_CPU_FIELD_LOCATION;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  return param;
+}
+
+static ColorSpinorParam deviceParam(QudaSiteSubset site_subset)
+{
+  ColorSpinorParam param = hostParam(site_subset);
+  param.location = QUDA_CUDA_FIELD_LOCATION;
+  param.setPrecision(QUDA_DOUBLE_PRECISION, QUDA_DOUBLE_PRECISION, true);
+  return param;
+}
+
+static std::vector<ColorSpinorField *> createSet(const ColorSpinorParam &param, QudaParity parity)
+{
+  std::vector<ColorSpinorField *> v;
+  for (int i = 0; i < n_vec; i++) {
+    v.push_back(ColorSpinorField::Create(param));
+    v.back()->setSuggestedParity(parity);
+  }
+  return v;
+}
+
+static void destroySet(std::vector<ColorSpinorField *> &v)
+{
+  for (auto f : v) delete f;
+  v.clear();
+}
+
+// number of vectors in b that differ from those in a, compared on the host
+static int mismatches(const std::vector<ColorSpinorField *> &a, const std::vector<ColorSpinorField *> &b,
+                      QudaSiteSubset site_subset)
+{
+  ColorSpinorField *ha = ColorSpinorField::Create(hostParam(site_subset));
+  ColorSpinorField *hb = ColorSpinorField::Create(hostParam(site_subset));
+  int count = 0;
+  for (unsigned int i = 0; i < a.size(); i++) {
+    *ha = *a[i];
+    *hb = *b[i];
+    if (memcmp(ha->V(), hb->V(), ha->Bytes()) != 0) count++;
+  }
+  delete ha;
+  delete hb;
+  return count;
+}
+
+/**
+   Save a random set with save_chunk, load it back with load_chunk
+   and return the number of vectors that do not match
+*/
+static int roundTrip(const ColorSpinorParam &param, QudaParity parity, bool inflate, int save_chunk, int load_chunk)
+{
+  const char *filename = "vector_io_test.tmp";
+  auto in = createSet(param, parity);
+  auto out = createSet(param, parity);
+
+  auto host = ColorSpinorField::Create(hostParam(param.siteSubset));
+  for (auto v : in) {
+    static_cast<cpuColorSpinorField *>(host)->Source(QUDA_RANDOM_SOURCE);
+    *v = *host;
+  }
+  delete host;
+
+  VectorIO(filename, inflate, save_chunk).save(in);
+  VectorIO(filename, inflate, load_chunk).load(out);
+  int count = mismatches(in, out, param.siteSubset);
+
+  comm_barrier();
+  if (comm_rank() == 0) remove(filename);
+  destroySet(in);
+  destroySet(out);
+  return count;
+}
+
+TEST(VectorIO, host_full_streamed)
+{
+  EXPECT_EQ(roundTrip(hostParam(QUDA_FULL_SITE_SUBSET), QUDA_INVALID_PARITY, false, chunk_size, chunk_size), 0);
+}
+
+TEST(VectorIO, device_full_streamed)
+{
+  EXPECT_EQ(roundTrip(deviceParam(QUDA_FULL_SITE_SUBSET), QUDA_INVALID_PARITY, false, chunk_size, chunk_size), 0);
+}
+
+TEST(VectorIO, device_parity_inflated_streamed)
+{
+  EXPECT_EQ(roundTrip(deviceParam(QUDA_PARITY_SITE_SUBSET), QUDA_ODD_PARITY, true, chunk_size, chunk_size), 0);
+}
+
+TEST(VectorIO, host_parity_inflated_streamed)
+{
+  EXPECT_EQ(roundTrip(hostParam(QUDA_PARITY_SITE_SUBSET), QUDA_EVEN_PARITY, true, chunk_size, chunk_size), 0);
+}
+
+TEST(VectorIO, single_record_read_streamed)
+{
+  // a file in the single record format is still read by a streaming reader
+  EXPECT_EQ(roundTrip(deviceParam(QUDA_PARITY_SITE_SUBSET), QUDA_ODD_PARITY, true, 0, chunk_size), 0);
+}
+
+TEST(VectorIO, streamed_read_single_record)
+{
+  EXPECT_EQ(roundTrip(deviceParam(QUDA_PARITY_SITE_SUBSET), QUDA_ODD_PARITY, true, chunk_size, 0), 0);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  int test_rc = 0;
+
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  // Ensure gtest prints only from rank 0
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+
+  initQuda(device_ordinal);
+  test_rc = RUN_ALL_TESTS();
+  endQuda();
+
+  finalizeComms();
+
+  return test_rc;
+}
@@ -58,6 +58,7 @@ int test_type = 0;
 quda::mgarray<int> nvec = {};
 quda::mgarray<char[256]> mg_vec_infile;
 quda::mgarray<char[256]> mg_vec_outfile;
+int mg_io_chunk_size = 0;
 QudaInverterType inv_type;
 bool inv_deflate = false;
 bool inv_multigrid = false;
@@ -176,6 +177,7 @@ int eig_max_restarts = 1000;
 double eig_tol = 1e-6;
 double eig_qr_tol = 1e-11;
 bool eig_use_eigen_qr = true;
+bool eig_use_eigen_arrow = false;
 bool eig_use_poly_acc = true;
 int eig_poly_deg = 100;
 double eig_amin = 0.1;
@@ -190,6 +192,7 @@ char eig_arpack_logfile[256] = "arpack_logfile.log";
 char eig_vec_infile[256] = "";
 char eig_vec_outfile[256] = "";
 bool eig_io_parity_inflate = false;
+int eig_io_chunk_size = 0;
 QudaPrecision eig_save_prec = QUDA_DOUBLE_PRECISION;
 
 // Parameters for the MG eigensolver.
@@ -207,6 +210,7 @@ quda::mgarray<int> mg_eig_max_restarts = {};
 quda::mgarray<double> mg_eig_tol = {};
 quda::mgarray<double> mg_eig_qr_tol = {};
 quda::mgarray<bool> mg_eig_use_eigen_qr = {};
+quda::mgarray<bool> mg_eig_use_eigen_arrow = {};
 quda::mgarray<bool> mg_eig_use_poly_acc = {};
 quda::mgarray<int> mg_eig_poly_deg = {};
 quda::mgarray<double> mg_eig_amin = {};
@@ -331,7 +335,8 @@ namespace
                                                            {"ca-cg", QUDA_CA_CG_INVERTER},
                                                            {"ca-cgne", QUDA_CA_CGNE_INVERTER},
                                                            {"ca-cgnr", QUDA_CA_CGNR_INVERTER},
-                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER}};
+                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER},
+                                                           {"direct-lu", QUDA_DIRECT_LU_INVERTER}};
 
   CLI::TransformPairs<QudaPrecision> precision_map {{"double", QUDA_DOUBLE_PRECISION},
                                                     {"single", QUDA_SINGLE_PRECISION},
@@ -698,6 +703,8 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
                       "Cross check the device data against ARPACK (requires ARPACK, default false)");
   opgroup->add_option("--eig-use-eigen-qr", eig_use_eigen_qr,
                       "Use Eigen to eigensolve the upper Hessenberg in IRAM, else use QUDA's QR code. (default true)");
+  opgroup->add_option("--eig-use-eigen-arrow", eig_use_eigen_arrow,
+                      "Use Eigen to eigensolve the arrow matrix in TRLM, else use QUDA's arrowhead solver. (default false)");
   opgroup->add_option("--eig-compute-svd", eig_compute_svd,
                       "Solve the MdagM problem, use to compute SVD of M (default false)");
   opgroup->add_option("--eig-max-restarts", eig_max_restarts, "Perform n iterations of the restart in the eigensolver");
@@ -725,6 +732,8 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
 
   opgroup->add_option("--eig-io-parity-inflate", eig_io_parity_inflate,
                       "Whether to inflate single-parity eigenvectors onto dual parity full fields for file I/O (default = false)");
+  opgroup->add_option("--eig-io-chunk-size", eig_io_chunk_size,
+                      "Number of eigenvectors to stage at a time for file I/O, 0 saves a single record (default = 0)");
 
   opgroup
     ->add_option("--eig-spectrum", eig_spectrum,
@@ -829,6 +838,9 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
   quda_app->add_mgoption(
     opgroup, "--mg-eig-use-eigen-qr", mg_eig_use_eigen_qr, CLI::Validator(),
     "Use Eigen to eigensolve the upper Hessenberg in IRAM, else use QUDA's QR code. (default true)");
+  quda_app->add_mgoption(
+    opgroup, "--mg-eig-use-eigen-arrow", mg_eig_use_eigen_arrow, CLI::Validator(),
+    "Use Eigen to eigensolve the arrow matrix in TRLM, else use QUDA's arrowhead solver. (default false)");
   quda_app->add_mgoption(opgroup, "--mg-eig-block-size", mg_eig_block_size, CLI::Validator(),
                          "The block size to use in the block variant eigensolver");
   quda_app->add_mgoption(opgroup, "--mg-eig-n-ev", mg_eig_n_ev, CLI::Validator(),
@@ -876,6 +888,8 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
                          "Load the vectors <file> for the multigrid_test (requires QIO)");
   quda_app->add_mgoption(opgroup, "--mg-save-vec", mg_vec_outfile, CLI::Validator(),
                          "Save the generated null-space vectors <file> from the multigrid_test (requires QIO)");
+  opgroup->add_option("--mg-io-chunk-size", mg_io_chunk_size,
+                      "Number of null-space vectors to stage at a time for file I/O, 0 saves a single record (default = 0)");
 
   quda_app
     ->add_mgoption("--mg-eig-save-prec", mg_eig_save_prec, CLI::Validator(),
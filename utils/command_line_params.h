@@ -191,6 +191,7 @@ extern int test_type;
 extern quda::mgarray<int> nvec;
 extern quda::mgarray<char[256]> mg_vec_infile;
 extern quda::mgarray<char[256]> mg_vec_outfile;
+extern int mg_io_chunk_size;
 extern QudaInverterType inv_type;
 extern bool inv_deflate;
 extern bool inv_multigrid;
@@ -300,6 +301,7 @@ extern int eig_max_restarts;
 extern double eig_tol;
 extern double eig_qr_tol;
 extern bool eig_use_eigen_qr;
+extern bool eig_use_eigen_arrow;
 extern bool eig_use_poly_acc;
 extern int eig_poly_deg;
 extern double eig_amin;
@@ -315,6 +317,7 @@ extern char eig_QUDA_logfile[256];
 extern char eig_vec_infile[256];
 extern char eig_vec_outfile[256];
 extern bool eig_io_parity_inflate;
+extern int eig_io_chunk_size;
 extern QudaPrecision eig_save_prec;
 
 // Parameters for the MG eigensolver.
@@ -332,6 +335,7 @@ extern quda::mgarray<int> mg_eig_max_restarts;
 extern quda::mgarray<double> mg_eig_tol;
 extern quda::mgarray<double> mg_eig_qr_tol;
 extern quda::mgarray<bool> mg_eig_use_eigen_qr;
+extern quda::mgarray<bool> mg_eig_use_eigen_arrow;
 extern quda::mgarray<bool> mg_eig_use_poly_acc;
 extern quda::mgarray<int> mg_eig_poly_deg;
 extern quda::mgarray<double> mg_eig_amin;
@@ -693,12 +693,15 @@ void exchange_cpu_sitelink_ex(int* X, int *R, void** sitelink, QudaGaugeFieldOrd
 
   int gaugebytes = gauge_site_size * gPrecision;
   int a, b, c,d;
+  // directions are exchanged in turn so that corners are propagated,
+  // but the packing and unpacking of each face is threaded
   for(int dir =0;dir < 4;dir++){
     if( (!commDimPartitioned(dir)) && optflag) continue;
     if(commDimPartitioned(dir)){
       //fill the sendbuf here
       //back
-      for(d=R[dir]; d < 2*R[dir]; d++)
+      for(d=R[dir]; d < 2*R[dir]; d++) {
+#pragma omp parallel for private(b, c)
 	for(a=starta[dir];a < enda[dir]; a++)
 	  for(b=startb[dir]; b < endb[dir]; b++)
 
@@ -735,10 +738,11 @@ void exchange_cpu_sitelink_ex(int* X, int *R, void** sitelink, QudaGaugeFieldOrd
 		}//if c
 	      }//for loop
 	    }//if
-      
-      
+      }
+
       //fwd
       for(d=X[dir]; d < X[dir]+R[dir]; d++) {
+#pragma omp parallel for private(b, c)
 	for(a=starta[dir];a < enda[dir]; a++) {
 	  for(b=startb[dir]; b < endb[dir]; b++) {
 	    
@@ -810,6 +814,7 @@ void exchange_cpu_sitelink_ex(int* X, int *R, void** sitelink, QudaGaugeFieldOrd
     if (dir < 3 ) {
 
       for(d=0; d < R[dir]; d++) {
+#pragma omp parallel for private(b, c)
 	for(a=starta[dir];a < enda[dir]; a++) {
 	  for(b=startb[dir]; b < endb[dir]; b++) {
 
@@ -863,6 +868,7 @@ void exchange_cpu_sitelink_ex(int* X, int *R, void** sitelink, QudaGaugeFieldOrd
     if( dir < 3 ){
 
       for(d=X[dir]+R[dir]; d < X[dir]+2*R[dir]; d++) {
+#pragma omp parallel for private(b, c)
 	for(a=starta[dir];a < enda[dir]; a++) {
 	  for(b=startb[dir]; b < endb[dir]; b++) {
 
@@ -939,35 +945,42 @@ do_exchange_cpu_staple(Float* staple, Float** ghost_staple, Float** staple_fwd_s
   size_t len[4] = {Vsh_x * gauge_site_size * sizeof(Float), Vsh_y * gauge_site_size * sizeof(Float),
                    Vsh_z * gauge_site_size * sizeof(Float), Vsh_t * gauge_site_size * sizeof(Float)};
 
-  for (int dir=0;dir < 4; dir++) {
+  MsgHandle *mh_recv_back[4];
+  MsgHandle *mh_recv_fwd[4];
+  MsgHandle *mh_send_fwd[4];
+  MsgHandle *mh_send_back[4];
 
+  // the staple faces are independent, so post every dimension at once
+  for (int dir=0;dir < 4; dir++) {
     Float *ghost_staple_back = ghost_staple[dir];
     Float *ghost_staple_fwd = ghost_staple[dir] + 2 * Vsh[dir] * gauge_site_size;
 
-    MsgHandle *mh_recv_back;
-    MsgHandle *mh_recv_fwd;
-    MsgHandle *mh_send_fwd;
-    MsgHandle *mh_send_back;
+    mh_recv_back[dir] = comm_declare_receive_relative(ghost_staple_back, dir, -1, 2*len[dir]);
+    mh_recv_fwd[dir] = comm_declare_receive_relative(ghost_staple_fwd, dir, +1, 2*len[dir]);
+    mh_send_fwd[dir] = comm_declare_send_relative(staple_fwd_sendbuf[dir], dir, +1, 2*len[dir]);
+    mh_send_back[dir] = comm_declare_send_relative(staple_back_sendbuf[dir], dir, -1, 2*len[dir]);
+  }
 
-    mh_recv_back = comm_declare_receive_relative(ghost_staple_back, dir, -1, 2*len[dir]);
-    mh_recv_fwd = comm_declare_receive_relative(ghost_staple_fwd, dir, +1, 2*len[dir]);
-    mh_send_fwd = comm_declare_send_relative(staple_fwd_sendbuf[dir], dir, +1, 2*len[dir]);
-    mh_send_back = comm_declare_send_relative(staple_back_sendbuf[dir], dir, -1, 2*len[dir]);
-    
-    comm_start(mh_recv_back);
-    comm_start(mh_recv_fwd);
-    comm_start(mh_send_fwd);
-    comm_start(mh_send_back);
+  for (int dir=0;dir < 4; dir++) {
+    comm_start(mh_recv_back[dir]);
+    comm_start(mh_recv_fwd[dir]);
+  }
 
-    comm_wait(mh_send_fwd);
-    comm_wait(mh_send_back);
-    comm_wait(mh_recv_back);
-    comm_wait(mh_recv_fwd);
+  for (int dir=0;dir < 4; dir++) {
+    comm_start(mh_send_fwd[dir]);
+    comm_start(mh_send_back[dir]);
+  }
 
-    comm_free(mh_send_fwd);
-    comm_free(mh_send_back);
-    comm_free(mh_recv_back);
-    comm_free(mh_recv_fwd);
+  for (int dir=0;dir < 4; dir++) {
+    comm_wait(mh_send_fwd[dir]);
+    comm_wait(mh_send_back[dir]);
+    comm_wait(mh_recv_back[dir]);
+    comm_wait(mh_recv_fwd[dir]);
+
+    comm_free(mh_send_fwd[dir]);
+    comm_free(mh_send_back[dir]);
+    comm_free(mh_recv_back[dir]);
+    comm_free(mh_recv_fwd[dir]);
   }
 }
 
@@ -309,6 +309,35 @@ void initRand()
   srand(17*rank + 137);
 }
 
+// key of the counter-based host random number generator
+static uint64_t host_rand_seed = 137;
+
+void setHostRandSeed(uint64_t seed) { host_rand_seed = seed; }
+
+double hostRandom(uint64_t site, uint32_t stream, uint32_t n)
+{
+  // each Philox block yields two 64-bit outputs
+  uint32_t ctr[4] = {n / 2, stream, static_cast<uint32_t>(site), static_cast<uint32_t>(site >> 32)};
+  const uint32_t key[2] = {static_cast<uint32_t>(host_rand_seed), static_cast<uint32_t>(host_rand_seed >> 32)};
+  quda::philox4x32_10(ctr, key);
+  const uint64_t r = (n & 1) ? (static_cast<uint64_t>(ctr[2]) << 32 | ctr[3]) : (static_cast<uint64_t>(ctr[0]) << 32 | ctr[1]);
+  return (r >> 11) * 0x1.0p-53;
+}
+
+uint64_t globalSiteIndex(int i, int oddBit)
+{
+  int x = fullLatticeIndex(i, oddBit);
+  uint64_t index = 0;
+  for (int d = 3; d >= 0; d--) {
+    int stride = 1;
+    for (int d2 = 0; d2 < d; d2++) stride *= Z[d2];
+    const int xd = x / stride;
+    x -= xd * stride;
+    index = index * (comm_dim(d) * Z[d]) + (comm_coord(d) * Z[d] + xd);
+  }
+  return index;
+}
+
 void setDims(int *X) {
   V = 1;
   for (int d=0; d< 4; d++) {
@@ -953,66 +982,61 @@ int x4_from_full_index(int i)
   return x4;
 }
 
-template <typename Float> void applyGaugeFieldScaling(Float **gauge, int Vh, QudaGaugeParam *param)
+/**
+   @brief Apply the anisotropy, temporal boundary condition and
+   temporal gauge fixing of param to a single link
+   @param[in,out] link The link
+   @param[in] dir Direction of the link
+   @param[in] i Checkerboard index of the link's site
+   @param[in] param Gauge parameters
+*/
+template <typename Float> static inline void scaleLink(Float *link, int dir, int i, const QudaGaugeParam *param)
 {
-  // Apply spatial scaling factor (u0) to spatial links
-  for (int d = 0; d < 3; d++) {
-    for (int i = 0; i < gauge_site_size * Vh * 2; i++) { gauge[d][i] /= param->anisotropy; }
-  }
+  // links on the last time slice are those with the last (Z[0]/2)*Z[1]*Z[2] checkerboard indices
+  const int t_last = (Z[0] / 2) * Z[1] * Z[2] * (Z[3] - 1);
 
-  // Apply boundary conditions to temporal links
-  if (param->t_boundary == QUDA_ANTI_PERIODIC_T && last_node_in_t()) {
-    for (int j = (Z[0]/2)*Z[1]*Z[2]*(Z[3]-1); j < Vh; j++) {
-      for (int i = 0; i < gauge_site_size; i++) {
-        gauge[3][j * gauge_site_size + i] *= -1.0;
-        gauge[3][(Vh + j) * gauge_site_size + i] *= -1.0;
-      }
-    }
-  }
-
-  if (param->gauge_fix) {
+  if (dir < 3) {
+    // Apply spatial scaling factor (u0) to spatial links
+    for (int k = 0; k < gauge_site_size; k++) link[k] /= param->anisotropy;
+  } else if (param->gauge_fix && (!last_node_in_t() || i < t_last)) {
     // set all gauge links (except for the last Z[0]*Z[1]*Z[2]/2) to the identity,
     // to simulate fixing to the temporal gauge.
-    int iMax = (last_node_in_t() ? (Z[0] / 2) * Z[1] * Z[2] * (Z[3] - 1) : Vh);
-    int dir = 3; // time direction only
-    Float *even = gauge[dir];
-    Float *odd = gauge[dir] + Vh * gauge_site_size;
-    for (int i = 0; i< iMax; i++) {
-      for (int m = 0; m < 3; m++) {
-	for (int n = 0; n < 3; n++) {
-	  even[i*(3*3*2) + m*(3*2) + n*(2) + 0] = (m==n) ? 1 : 0;
-	  even[i*(3*3*2) + m*(3*2) + n*(2) + 1] = 0.0;
-	  odd [i*(3*3*2) + m*(3*2) + n*(2) + 0] = (m==n) ? 1 : 0;
-	  odd [i*(3*3*2) + m*(3*2) + n*(2) + 1] = 0.0;
-	}
+    for (int m = 0; m < 3; m++) {
+      for (int n = 0; n < 3; n++) {
+        link[m * (3 * 2) + n * (2) + 0] = (m == n) ? 1 : 0;
+        link[m * (3 * 2) + n * (2) + 1] = 0.0;
       }
     }
+  } else if (param->t_boundary == QUDA_ANTI_PERIODIC_T && last_node_in_t() && i >= t_last) {
+    // Apply boundary conditions to temporal links
+    for (int k = 0; k < gauge_site_size; k++) link[k] *= -1.0;
   }
 }
 
-// static void constructUnitGaugeField(Float **res, QudaGaugeParam *param) {
-template <typename Float> void constructUnitGaugeField(Float **res, QudaGaugeParam *param)
+template <typename Float> void applyGaugeFieldScaling(Float **gauge, int Vh, QudaGaugeParam *param)
 {
-  Float *resOdd[4], *resEven[4];
   for (int dir = 0; dir < 4; dir++) {
-    resEven[dir] = res[dir];
-    resOdd[dir] = res[dir] + Vh * gauge_site_size;
+#pragma omp parallel for
+    for (int i = 0; i < 2 * Vh; i++) scaleLink(gauge[dir] + i * gauge_site_size, dir, i % Vh, param);
   }
+}
 
+// static void constructUnitGaugeField(Float **res, QudaGaugeParam *param) {
+template <typename Float> void constructUnitGaugeField(Float **res, QudaGaugeParam *param)
+{
   for (int dir = 0; dir < 4; dir++) {
-    for (int i = 0; i < Vh; i++) {
+#pragma omp parallel for
+    for (int i = 0; i < V; i++) {
+      Float *link = res[dir] + i * gauge_site_size;
       for (int m = 0; m < 3; m++) {
-	for (int n = 0; n < 3; n++) {
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = (m==n) ? 1 : 0;
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 0.0;
-	  resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = (m==n) ? 1 : 0;
-	  resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 0.0;
-	}
+        for (int n = 0; n < 3; n++) {
+          link[m * (3 * 2) + n * (2) + 0] = (m == n) ? 1 : 0;
+          link[m * (3 * 2) + n * (2) + 1] = 0.0;
+        }
       }
+      scaleLink(link, dir, i % Vh, param);
     }
   }
-
-  applyGaugeFieldScaling(res, Vh, param);
 }
 
 // normalize the vector a
@@ -1031,148 +1055,106 @@ static void orthogonalize(complex<Float> *a, complex<Float> *b, int len) {
   for (int i=0; i<len; i++) b[i] -= (complex<Float>)dot*a[i];
 }
 
-template <typename Float> void constructRandomGaugeField(Float **res, QudaGaugeParam *param, QudaDslashType dslash_type)
+// streams of the counter-based host random number generator
+constexpr uint32_t host_rand_gauge_stream = 1;
+constexpr uint32_t host_rand_fat_link_stream = 2;
+constexpr uint32_t host_rand_mom_stream = 3;
+constexpr uint32_t host_rand_hw_stream = 4;
+constexpr uint32_t host_rand_clover_stream = 5;
+
+/**
+   @brief Construct a random SU(3) link: the last two rows are drawn
+   from the host random number stream of the link, orthonormalized,
+   and the first row is their conjugate cross product
+   @param[out] link The link
+   @param[in] dir Direction of the link
+   @param[in] i Full-lattice (parity-ordered) index of the link's site
+*/
+template <typename Float> static inline void randomUnitaryLink(Float *link, int dir, int i)
 {
-  Float *resOdd[4], *resEven[4];
-  for (int dir = 0; dir < 4; dir++) {
-    resEven[dir] = res[dir];
-    resOdd[dir] = res[dir] + Vh * gauge_site_size;
+  const int oddBit = i >= Vh ? 1 : 0;
+  const uint64_t site = globalSiteIndex(i - oddBit * Vh, oddBit);
+
+  for (int m = 1; m < 3; m++) { // last 2 rows
+    for (int n = 0; n < 3; n++) { // 3 columns
+      for (int c = 0; c < 2; c++) {
+        const int k = m * (3 * 2) + n * (2) + c;
+        link[k] = hostRandom(site, host_rand_gauge_stream, dir * gauge_site_size + k);
+      }
+    }
   }
+  normalize((complex<Float> *)(link + 1 * 3 * 2), 3);
+  orthogonalize((complex<Float> *)(link + 1 * 3 * 2), (complex<Float> *)(link + 2 * 3 * 2), 3);
+  normalize((complex<Float> *)(link + 2 * 3 * 2), 3);
 
-  for (int dir = 0; dir < 4; dir++) {
-    for (int i = 0; i < Vh; i++) {
-      for (int m = 1; m < 3; m++) { // last 2 rows
-	for (int n = 0; n < 3; n++) { // 3 columns
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = rand() / (Float)RAND_MAX;
-	  resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-          resOdd[dir][i * (3 * 3 * 2) + m * (3 * 2) + n * (2) + 1] = rand() / (Float)RAND_MAX;
-        }
-      }
-      normalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), (complex<Float>*)(resEven[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resEven[dir] + (i*3 + 2)*3*2), 3);
-
-      normalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), (complex<Float>*)(resOdd[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resOdd[dir] + (i*3 + 2)*3*2), 3);
-
-      {
-	Float *w = resEven[dir]+(i*3+0)*3*2;
-	Float *u = resEven[dir]+(i*3+1)*3*2;
-	Float *v = resEven[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
+  Float *w = link + 0 * 3 * 2;
+  Float *u = link + 1 * 3 * 2;
+  Float *v = link + 2 * 3 * 2;
 
-      {
-	Float *w = resOdd[dir]+(i*3+0)*3*2;
-	Float *u = resOdd[dir]+(i*3+1)*3*2;
-	Float *v = resOdd[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
+  for (int n = 0; n < 6; n++) w[n] = 0.0;
+  accumulateConjugateProduct(w + 0 * (2), u + 1 * (2), v + 2 * (2), +1);
+  accumulateConjugateProduct(w + 0 * (2), u + 2 * (2), v + 1 * (2), -1);
+  accumulateConjugateProduct(w + 1 * (2), u + 2 * (2), v + 0 * (2), +1);
+  accumulateConjugateProduct(w + 1 * (2), u + 0 * (2), v + 2 * (2), -1);
+  accumulateConjugateProduct(w + 2 * (2), u + 0 * (2), v + 1 * (2), +1);
+  accumulateConjugateProduct(w + 2 * (2), u + 1 * (2), v + 0 * (2), -1);
+}
 
-    }
+template <typename Float> void constructUnitaryGaugeField(Float **res)
+{
+  for (int dir = 0; dir < 4; dir++) {
+#pragma omp parallel for
+    for (int i = 0; i < V; i++) randomUnitaryLink(res[dir] + i * gauge_site_size, dir, i);
   }
+}
 
+template <typename Float> void constructRandomGaugeField(Float **res, QudaGaugeParam *param, QudaDslashType dslash_type)
+{
   if (param->type == QUDA_WILSON_LINKS) {
-    applyGaugeFieldScaling(res, Vh, param);
-  } else if (param->type == QUDA_ASQTAD_LONG_LINKS) {
-    applyGaugeFieldScaling_long(res, Vh, param, dslash_type);
-  } else if (param->type == QUDA_ASQTAD_FAT_LINKS) {
+    // build, reunitarize and scale each link in a single sweep
     for (int dir = 0; dir < 4; dir++) {
-      for (int i = 0; i < Vh; i++) {
-	for (int m = 0; m < 3; m++) { // last 2 rows
-	  for (int n = 0; n < 3; n++) { // 3 columns
-	    resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] =1.0* rand() / (Float)RAND_MAX;
-	    resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 2.0* rand() / (Float)RAND_MAX;
-	    resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = 3.0*rand() / (Float)RAND_MAX;
-	    resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 4.0*rand() / (Float)RAND_MAX;
-	  }
-	}
+#pragma omp parallel for
+      for (int i = 0; i < V; i++) {
+        Float *link = res[dir] + i * gauge_site_size;
+        randomUnitaryLink(link, dir, i);
+        scaleLink(link, dir, i % Vh, param);
       }
     }
+    return;
   }
-}
 
-template <typename Float> void constructUnitaryGaugeField(Float **res)
-{
-  Float *resOdd[4], *resEven[4];
-  for (int dir = 0; dir < 4; dir++) {
-    resEven[dir] = res[dir];
-    resOdd[dir] = res[dir] + Vh * gauge_site_size;
-  }
+  constructUnitaryGaugeField(res);
 
-  for (int dir = 0; dir < 4; dir++) {
-    for (int i = 0; i < Vh; i++) {
-      for (int m = 1; m < 3; m++) { // last 2 rows
-	for (int n = 0; n < 3; n++) { // 3 columns
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = rand() / (Float)RAND_MAX;
-	  resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-          resOdd[dir][i * (3 * 3 * 2) + m * (3 * 2) + n * (2) + 1] = rand() / (Float)RAND_MAX;
+  if (param->type == QUDA_ASQTAD_LONG_LINKS) {
+    applyGaugeFieldScaling_long(res, Vh, param, dslash_type);
+  } else if (param->type == QUDA_ASQTAD_FAT_LINKS) {
+    for (int dir = 0; dir < 4; dir++) {
+#pragma omp parallel for
+      for (int i = 0; i < V; i++) {
+        const int oddBit = i >= Vh ? 1 : 0;
+        const uint64_t site = globalSiteIndex(i - oddBit * Vh, oddBit);
+        Float *link = res[dir] + i * gauge_site_size;
+        for (int m = 0; m < 3; m++) {
+          for (int n = 0; n < 3; n++) {
+            const int k = m * (3 * 2) + n * (2);
+            link[k + 0] = (1.0 + 2 * oddBit) * hostRandom(site, host_rand_fat_link_stream, dir * gauge_site_size + k + 0);
+            link[k + 1] = (2.0 + 2 * oddBit) * hostRandom(site, host_rand_fat_link_stream, dir * gauge_site_size + k + 1);
+          }
         }
       }
-      normalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), (complex<Float>*)(resEven[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resEven[dir] + (i*3 + 2)*3*2), 3);
-
-      normalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), (complex<Float>*)(resOdd[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resOdd[dir] + (i*3 + 2)*3*2), 3);
-
-      {
-	Float *w = resEven[dir]+(i*3+0)*3*2;
-	Float *u = resEven[dir]+(i*3+1)*3*2;
-	Float *v = resEven[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
-
-      {
-	Float *w = resOdd[dir]+(i*3+0)*3*2;
-	Float *u = resOdd[dir]+(i*3+1)*3*2;
-	Float *v = resOdd[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
     }
   }
 }
 
 template <typename Float> void constructCloverField(Float *res, double norm, double diag)
 {
+#pragma omp parallel for
+  for (int i = 0; i < V; i++) {
+    const int oddBit = i >= Vh ? 1 : 0;
+    const uint64_t site = globalSiteIndex(i - oddBit * Vh, oddBit);
 
-  Float c = 2.0 * norm / RAND_MAX;
-
-  for(int i = 0; i < V; i++) {
     for (int j = 0; j < 72; j++) {
-      res[i*72 + j] = c*rand() - norm;
+      res[i*72 + j] = 2.0 * norm * hostRandom(site, host_rand_clover_stream, j) - norm;
     }
 
     //impose clover symmetry on each chiral block
@@ -1247,6 +1229,7 @@ void createSiteLinkCPU(void **link, QudaPrecision precision, int phase)
 
   if(phase){
 
+#pragma omp parallel for
     for(int i=0;i < V;i++){
       for(int dir =XUP; dir <= TUP; dir++){
 	int idx = i;
@@ -1437,58 +1420,48 @@ int strong_check_link(void **linkA, const char *msgA, void **linkB, const char *
   return ret;
 }
 
-void createMomCPU(void *mom, QudaPrecision precision)
+template <typename Float> static void createMomCPU(Float *mom)
 {
-  void* temp;
-
-  size_t gSize = (precision == QUDA_DOUBLE_PRECISION) ? sizeof(double) : sizeof(float);
-  temp = malloc(4 * V * gauge_site_size * gSize);
-  if (temp == NULL){
-    fprintf(stderr, "Error: malloc failed for temp in function %s\n", __FUNCTION__);
-    exit(1);
-  }
-
-  for(int i=0;i < V;i++){
-    if (precision == QUDA_DOUBLE_PRECISION){
-      for(int dir=0;dir < 4;dir++){
-        double *thismom = (double *)mom;
-        for (int k = 0; k < mom_site_size; k++) {
-          thismom[(4 * i + dir) * mom_site_size + k] = 1.0 * rand() / RAND_MAX;
-          if (k == mom_site_size - 1) thismom[(4 * i + dir) * mom_site_size + k] = 0.0;
-        }
-      }
-    }else{
-      for(int dir=0;dir < 4;dir++){
-	float* thismom=(float*)mom;
-        for (int k = 0; k < mom_site_size; k++) {
-          thismom[(4 * i + dir) * mom_site_size + k] = 1.0 * rand() / RAND_MAX;
-          if (k == mom_site_size - 1) thismom[(4 * i + dir) * mom_site_size + k] = 0.0;
-        }
+#pragma omp parallel for
+  for (int i = 0; i < V; i++) {
+    const int oddBit = i >= Vh ? 1 : 0;
+    const uint64_t site = globalSiteIndex(i - oddBit * Vh, oddBit);
+    for (int dir = 0; dir < 4; dir++) {
+      for (int k = 0; k < mom_site_size; k++) {
+        mom[(4 * i + dir) * mom_site_size + k] = hostRandom(site, host_rand_mom_stream, dir * mom_site_size + k);
+        if (k == mom_site_size - 1) mom[(4 * i + dir) * mom_site_size + k] = 0.0;
       }
     }
   }
+}
 
-  free(temp);
-  return;
+void createMomCPU(void *mom, QudaPrecision precision)
+{
+  if (precision == QUDA_DOUBLE_PRECISION)
+    createMomCPU(static_cast<double *>(mom));
+  else
+    createMomCPU(static_cast<float *>(mom));
 }
 
-void createHwCPU(void *hw, QudaPrecision precision)
+template <typename Float> static void createHwCPU(Float *hw)
 {
-  for(int i=0;i < V;i++){
-    if (precision == QUDA_DOUBLE_PRECISION){
-      for(int dir=0;dir < 4;dir++){
-	double* thishw = (double*)hw;
-        for (int k = 0; k < hw_site_size; k++) { thishw[(4 * i + dir) * hw_site_size + k] = 1.0 * rand() / RAND_MAX; }
-      }
-    }else{
-      for(int dir=0;dir < 4;dir++){
-	float* thishw=(float*)hw;
-        for (int k = 0; k < hw_site_size; k++) { thishw[(4 * i + dir) * hw_site_size + k] = 1.0 * rand() / RAND_MAX; }
-      }
+#pragma omp parallel for
+  for (int i = 0; i < V; i++) {
+    const int oddBit = i >= Vh ? 1 : 0;
+    const uint64_t site = globalSiteIndex(i - oddBit * Vh, oddBit);
+    for (int dir = 0; dir < 4; dir++) {
+      for (int k = 0; k < hw_site_size; k++)
+        hw[(4 * i + dir) * hw_site_size + k] = hostRandom(site, host_rand_hw_stream, dir * hw_site_size + k);
     }
   }
+}
 
-  return;
+void createHwCPU(void *hw, QudaPrecision precision)
+{
+  if (precision == QUDA_DOUBLE_PRECISION)
+    createHwCPU(static_cast<double *>(hw));
+  else
+    createHwCPU(static_cast<float *>(hw));
 }
 
 
@@ -3,6 +3,7 @@
 #include <quda.h>
 #include <random_quda.h>
 #include <vector>
+#include <cstdint>
 #include <color_spinor_field.h>
 
 #define gauge_site_size 18      // real numbers per link
@@ -124,6 +125,34 @@ void initComms(int argc, char **argv, int *const commDims);
 void finalizeComms();
 void initRand();
 
+/**
+   @brief Set the key of the counter-based host random number
+   generator.  Unlike initRand, the key is the same on all ranks.
+   @param[in] seed The key
+*/
+void setHostRandSeed(uint64_t seed);
+
+/**
+   @brief Counter-based (Philox4x32-10) host random number generator.
+   The result is a pure function of the global site, stream and
+   element number, so fields constructed with it can be filled in
+   parallel, and are independent of the thread count and process grid.
+   @param[in] site Global lexicographic site index, see globalSiteIndex
+   @param[in] stream Stream id, distinct for each type of field
+   @param[in] n Element number within the site
+   @return Uniform random number in [0, 1)
+*/
+double hostRandom(uint64_t site, uint32_t stream, uint32_t n);
+
+/**
+   @brief Return the global lexicographic index of a local
+   checkerboarded site
+   @param[in] i Local checkerboard index
+   @param[in] oddBit Parity of the site
+   @return Global site index
+*/
+uint64_t globalSiteIndex(int i, int oddBit);
+
 int lex_rank_from_coords_t(const int *coords, void *fdata);
 int lex_rank_from_coords_x(const int *coords, void *fdata);
 
@@ -10,6 +10,8 @@
 #include <staggered_gauge_utils.h>
 #include <llfat_utils.h>
 #include <unitarization_links.h>
+#include <gauge_field.h>
+#include <gauge_tools.h>
 #include "misc.h"
 
 extern double tadpole_factor;
@@ -299,21 +301,31 @@ void computeStaggeredPlaquetteQDPOrder(void **qdp_link, double plaq[3], const Qu
   gauge_param.anisotropy = 1;
   gauge_param.gauge_fix = QUDA_GAUGE_FIXED_NO;
 
-  gauge_param.ga_pad = 0;
-  // For multi-GPU, ga_pad must be large enough to store a time-slice
+  if (comm_size() == 1) {
+    // a single process needs no halo, so measure the host field in
+    // place rather than uploading it to the device
+    quda::GaugeFieldParam param(qdp_link, gauge_param);
+    quda::cpuGaugeField u(param);
+    quda::GaugeObservablesCPU obs;
+    quda::gaugeObservablesCPU(obs, u, false);
+    for (int i = 0; i < 3; i++) plaq[i] = obs.plaquette[i];
+  } else {
+    gauge_param.ga_pad = 0;
+    // For multi-GPU, ga_pad must be large enough to store a time-slice
 #ifdef MULTI_GPU
-  int x_face_size = gauge_param.X[1] * gauge_param.X[2] * gauge_param.X[3] / 2;
-  int y_face_size = gauge_param.X[0] * gauge_param.X[2] * gauge_param.X[3] / 2;
-  int z_face_size = gauge_param.X[0] * gauge_param.X[1] * gauge_param.X[3] / 2;
-  int t_face_size = gauge_param.X[0] * gauge_param.X[1] * gauge_param.X[2] / 2;
-  int pad_size = x_face_size > y_face_size ? x_face_size : y_face_size;
-  pad_size = pad_size > z_face_size ? pad_size : z_face_size;
-  pad_size = pad_size > t_face_size ? pad_size : t_face_size;
-  gauge_param.ga_pad = pad_size;
+    int x_face_size = gauge_param.X[1] * gauge_param.X[2] * gauge_param.X[3] / 2;
+    int y_face_size = gauge_param.X[0] * gauge_param.X[2] * gauge_param.X[3] / 2;
+    int z_face_size = gauge_param.X[0] * gauge_param.X[1] * gauge_param.X[3] / 2;
+    int t_face_size = gauge_param.X[0] * gauge_param.X[1] * gauge_param.X[2] / 2;
+    int pad_size = x_face_size > y_face_size ? x_face_size : y_face_size;
+    pad_size = pad_size > z_face_size ? pad_size : z_face_size;
+    pad_size = pad_size > t_face_size ? pad_size : t_face_size;
+    gauge_param.ga_pad = pad_size;
 #endif
 
-  loadGaugeQuda(qdp_link, &gauge_param);
-  plaqQuda(plaq);
+    loadGaugeQuda(qdp_link, &gauge_param);
+    plaqQuda(plaq);
+  }
 
   if (dslash_type == QUDA_STAGGERED_DSLASH || dslash_type == QUDA_ASQTAD_DSLASH) {
     plaq[0] = -plaq[0];
@@ -787,6 +787,7 @@ void applyGaugeFieldScaling_long(Float **gauge, int Vh, QudaGaugeParam *param, Q
   // rescale long links by the appropriate coefficient
   if (dslash_type == QUDA_ASQTAD_DSLASH) {
     for (int d = 0; d < 4; d++) {
+#pragma omp parallel for
       for (int i = 0; i < V * gauge_site_size; i++) {
         gauge[d][i] /= (-24 * param->tadpole_coeff * param->tadpole_coeff);
       }
@@ -797,6 +798,7 @@ void applyGaugeFieldScaling_long(Float **gauge, int Vh, QudaGaugeParam *param, Q
   for (int d = 0; d < 3; d++) {
 
     // even
+#pragma omp parallel for
     for (int i = 0; i < Vh; i++) {
 
       int index = fullLatticeIndex(i, 0);
@@ -820,6 +822,7 @@ void applyGaugeFieldScaling_long(Float **gauge, int Vh, QudaGaugeParam *param, Q
       for (int j = 0; j < 18; j++) { gauge[d][i * gauge_site_size + j] *= sign; }
     }
     // odd
+#pragma omp parallel for
     for (int i = 0; i < Vh; i++) {
       int index = fullLatticeIndex(i, 1);
       int i4 = index / (X3 * X2 * X1);
@@ -845,6 +848,7 @@ void applyGaugeFieldScaling_long(Float **gauge, int Vh, QudaGaugeParam *param, Q
 
   // Apply boundary conditions to temporal links
   if (param->t_boundary == QUDA_ANTI_PERIODIC_T && last_node_in_t()) {
+#pragma omp parallel for
     for (int j = 0; j < Vh; j++) {
       int sign = 1;
       if (dslash_type == QUDA_ASQTAD_DSLASH) {